@@ -0,0 +1,419 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <string>
+#include "Constants.h"
+#include "Instrumentation.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    namespace Detail
+    {
+        // Four lanes of T, aligned to their full width: one SSE/NEON register for float, one AVX register
+        // for double. Wider types fall back to their natural alignment.
+        template<std::floating_point T>
+        inline constexpr std::size_t kPaddedAlignment = (4 * sizeof(T) <= 32) ? 4 * sizeof(T) : alignof(T);
+    }
+
+    // Vector3 padded to four lanes and aligned to their width. Every operation touches all four lanes
+    // with the padding held at zero, so the compiler can keep the value in one register and emit packed
+    // instructions for per-object math that cannot be batched.
+    template<std::floating_point T>
+    struct alignas(Detail::kPaddedAlignment<T>) Vector3A
+    {
+        T x;
+        T y;
+        T z;
+
+        constexpr Vector3A() noexcept : x(kZero<T>), y(kZero<T>), z(kZero<T>), m_pad(kZero<T>) {}
+
+        constexpr Vector3A(T x, T y, T z) noexcept : x(x), y(y), z(z), m_pad(kZero<T>) {}
+
+        constexpr explicit Vector3A(const Vector3<T>& v) noexcept : Vector3A(v.x, v.y, v.z) {}
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        // Counted with Vector3::Normalize; the padded layout is the same operation.
+        void Normalize() noexcept
+        {
+            VEC23_COUNT(Vector3Normalize);
+            T lengthSq = LengthSquared();
+            if (lengthSq > kSafetyEpsilon<T>)
+            {
+                *this *= kOne<T> / std::sqrt(lengthSq);
+            }
+            else
+            {
+                VEC23_COUNT(Vector3NormalizeDegenerate);
+                *this = Vector3A();
+            }
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr Vector3<T> ToVector3() const noexcept
+        {
+            return { x, y, z };
+        }
+
+        bool IsNormalized() const noexcept
+        {
+            return std::abs(LengthSquared() - kOne<T>) < kToleranceEpsilon<T>;
+        }
+
+        Vector3A GetNormalized() const noexcept
+        {
+            Vector3A result = *this;
+            result.Normalize();
+            return result;
+        }
+
+        T Length() const noexcept
+        {
+            return std::sqrt(LengthSquared());
+        }
+
+        constexpr T LengthSquared() const noexcept
+        {
+            return Dot(*this);
+        }
+
+        constexpr T Dot(const Vector3A& other) const noexcept
+        {
+            return (x * other.x) + (y * other.y) + (z * other.z) + (m_pad * other.m_pad);
+        }
+
+        constexpr Vector3A Cross(const Vector3A& other) const noexcept
+        {
+            return
+            {
+                (y * other.z) - (z * other.y),
+                (z * other.x) - (x * other.z),
+                (x * other.y) - (y * other.x)
+            };
+        }
+
+        bool IsNearlyEqual(const Vector3A& other, T epsilon = kToleranceEpsilon<T>) const noexcept
+        {
+            return DistanceSquared(*this, other) < (epsilon * epsilon);
+        }
+
+        std::string ToString() const
+        {
+            return std::format("{}", *this);
+        }
+
+        // -------------------------
+        // Utilities
+        // -------------------------
+
+        static T Distance(const Vector3A& a, const Vector3A& b) noexcept
+        {
+            return (b - a).Length();
+        }
+
+        static constexpr T DistanceSquared(const Vector3A& a, const Vector3A& b) noexcept
+        {
+            return (b - a).LengthSquared();
+        }
+
+        static constexpr Vector3A Reflect(const Vector3A& v, const Vector3A& n) noexcept
+        {
+            return v - n * (kTwo<T> * v.Dot(n));
+        }
+
+        static constexpr Vector3A Lerp(const Vector3A& a, const Vector3A& b, T t) noexcept
+        {
+            return a + (b - a) * t;
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const Vector3A& other) const noexcept = default;
+
+        constexpr Vector3A operator+(const Vector3A& other) const noexcept
+        {
+            return { x + other.x, y + other.y, z + other.z, m_pad + other.m_pad };
+        }
+
+        constexpr Vector3A operator-(const Vector3A& other) const noexcept
+        {
+            return { x - other.x, y - other.y, z - other.z, m_pad - other.m_pad };
+        }
+
+        constexpr Vector3A operator*(const Vector3A& other) const noexcept
+        {
+            return { x * other.x, y * other.y, z * other.z, m_pad * other.m_pad };
+        }
+
+        // The pad is written as zero rather than scaled, which would turn it into NaN for an infinite scalar.
+        constexpr Vector3A operator*(T scalar) const noexcept
+        {
+            return { x * scalar, y * scalar, z * scalar, kZero<T> };
+        }
+
+        constexpr Vector3A operator/(T scalar) const noexcept
+        {
+            return *this * (kOne<T> / scalar);
+        }
+
+        constexpr Vector3A operator-() const noexcept
+        {
+            return { -x, -y, -z, -m_pad };
+        }
+
+        constexpr Vector3A& operator+=(const Vector3A& other) noexcept
+        {
+            *this = *this + other;
+            return *this;
+        }
+
+        constexpr Vector3A& operator-=(const Vector3A& other) noexcept
+        {
+            *this = *this - other;
+            return *this;
+        }
+
+        constexpr Vector3A& operator*=(T scalar) noexcept
+        {
+            *this = *this * scalar;
+            return *this;
+        }
+
+        constexpr Vector3A& operator/=(T scalar) noexcept
+        {
+            *this *= kOne<T> / scalar;
+            return *this;
+        }
+
+        constexpr T& operator[](int index) noexcept
+        {
+            assert(index >= 0 && index < 3);
+            return (&x)[index];
+        }
+
+        constexpr const T& operator[](int index) const noexcept
+        {
+            assert(index >= 0 && index < 3);
+            return (&x)[index];
+        }
+
+        constexpr friend Vector3A operator*(T scalar, const Vector3A& v) noexcept
+        {
+            return v * scalar;
+        }
+
+    private:
+        // Always zero; it only gives the arithmetic a full fourth lane.
+        T m_pad;
+
+        constexpr Vector3A(T x, T y, T z, T pad) noexcept : x(x), y(y), z(z), m_pad(pad) {}
+    };
+
+    // Quaternion aligned to the width of its four lanes, for use alongside Vector3A.
+    template<std::floating_point T>
+    struct alignas(Detail::kPaddedAlignment<T>) QuaternionA
+    {
+        T w;
+        T x;
+        T y;
+        T z;
+
+        constexpr QuaternionA() noexcept : w(kOne<T>), x(kZero<T>), y(kZero<T>), z(kZero<T>) {}
+
+        constexpr QuaternionA(T w, T x, T y, T z) noexcept : w(w), x(x), y(y), z(z) {}
+
+        constexpr explicit QuaternionA(const Quaternion<T>& q) noexcept : QuaternionA(q.w, q.x, q.y, q.z) {}
+
+        static constexpr QuaternionA Identity() noexcept
+        {
+            return QuaternionA();
+        }
+
+        static QuaternionA FromAxisAngle(const Vector3<T>& axis, T degrees) noexcept
+        {
+            return QuaternionA(Quaternion<T>::FromAxisAngle(axis, degrees));
+        }
+
+        static QuaternionA FromEuler(T rollDegrees, T pitchDegrees, T yawDegrees) noexcept
+        {
+            return QuaternionA(Quaternion<T>::FromEuler(rollDegrees, pitchDegrees, yawDegrees));
+        }
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        // Counted with Quaternion::Normalize; the padded layout is the same operation.
+        void Normalize() noexcept
+        {
+            VEC23_COUNT(QuaternionNormalize);
+            T lengthSq = LengthSquared();
+            if (lengthSq > kSafetyEpsilon<T>)
+            {
+                *this = *this * (kOne<T> / std::sqrt(lengthSq));
+            }
+            else
+            {
+                VEC23_COUNT(QuaternionNormalizeDegenerate);
+                *this = Identity();
+            }
+        }
+
+        constexpr void Conjugate() noexcept
+        {
+            x = -x;
+            y = -y;
+            z = -z;
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr Quaternion<T> ToQuaternion() const noexcept
+        {
+            return { w, x, y, z };
+        }
+
+        bool IsNormalized() const noexcept
+        {
+            return std::abs(LengthSquared() - kOne<T>) < kToleranceEpsilon<T>;
+        }
+
+        T Length() const noexcept
+        {
+            return std::sqrt(LengthSquared());
+        }
+
+        constexpr T LengthSquared() const noexcept
+        {
+            return Dot(*this);
+        }
+
+        constexpr T Dot(const QuaternionA& other) const noexcept
+        {
+            return (w * other.w) + (x * other.x) + (y * other.y) + (z * other.z);
+        }
+
+        QuaternionA GetNormalized() const noexcept
+        {
+            QuaternionA result = *this;
+            result.Normalize();
+            return result;
+        }
+
+        constexpr QuaternionA GetConjugated() const noexcept
+        {
+            QuaternionA result = *this;
+            result.Conjugate();
+            return result;
+        }
+
+        constexpr QuaternionA GetInversed() const noexcept
+        {
+            return QuaternionA(ToQuaternion().GetInversed());
+        }
+
+        constexpr Vector3A<T> RotateVector(const Vector3A<T>& v) const noexcept
+        {
+            Vector3A<T> u(x, y, z);
+            Vector3A<T> t = u.Cross(v) * kTwo<T>;
+            return v + t * w + u.Cross(t);
+        }
+
+        bool IsNearlyEqual(const QuaternionA& other, T epsilon = kSafetyEpsilon<T>) const noexcept
+        {
+            return ToQuaternion().IsNearlyEqual(other.ToQuaternion(), epsilon);
+        }
+
+        std::string ToString() const
+        {
+            return ToQuaternion().ToString();
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const QuaternionA& other) const noexcept = default;
+
+        constexpr QuaternionA operator+(const QuaternionA& other) const noexcept
+        {
+            return { w + other.w, x + other.x, y + other.y, z + other.z };
+        }
+
+        constexpr QuaternionA operator-(const QuaternionA& other) const noexcept
+        {
+            return { w - other.w, x - other.x, y - other.y, z - other.z };
+        }
+
+        constexpr QuaternionA operator*(const QuaternionA& other) const noexcept
+        {
+            return QuaternionA(
+                w * other.w - x * other.x - y * other.y - z * other.z,
+                w * other.x + x * other.w + y * other.z - z * other.y,
+                w * other.y - x * other.z + y * other.w + z * other.x,
+                w * other.z + x * other.y - y * other.x + z * other.w
+            );
+        }
+
+        constexpr QuaternionA operator*(T scalar) const noexcept
+        {
+            return { w * scalar, x * scalar, y * scalar, z * scalar };
+        }
+
+        constexpr Vector3A<T> operator*(const Vector3A<T>& v) const noexcept
+        {
+            return RotateVector(v);
+        }
+
+        constexpr QuaternionA operator-() const noexcept
+        {
+            return { -w, -x, -y, -z };
+        }
+
+        constexpr QuaternionA& operator*=(const QuaternionA& other) noexcept
+        {
+            *this = *this * other;
+            return *this;
+        }
+
+        constexpr friend QuaternionA operator*(T scalar, const QuaternionA& q) noexcept
+        {
+            return q * scalar;
+        }
+    };
+
+    using FVector3A = Vector3A<float>;
+    using DVector3A = Vector3A<double>;
+    using LDVector3A = Vector3A<long double>;
+
+    using FQuaternionA = QuaternionA<float>;
+    using DQuaternionA = QuaternionA<double>;
+    using LDQuaternionA = QuaternionA<long double>;
+}
+
+template<std::floating_point T>
+struct std::formatter<Vec23::Vector3A<T>> : std::formatter<Vec23::Vector3<T>>
+{
+    template<typename FormatContext>
+    auto format(const Vec23::Vector3A<T>& v, FormatContext& ctx) const
+    {
+        return std::formatter<Vec23::Vector3<T>>::format(v.ToVector3(), ctx);
+    }
+};
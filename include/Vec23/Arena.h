@@ -0,0 +1,110 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace Vec23
+{
+    // Bump allocator for per-frame scratch data. One block is reserved up front, allocating bumps a
+    // pointer into it, deallocating does nothing, and Reset() recycles the whole block at once. Requests
+    // that do not fit spill to the upstream resource until the next Reset(); a nonzero OverflowBytes()
+    // means the arena should be sized up to HighWaterMark(). Not thread-safe.
+    class FrameArena : public std::pmr::memory_resource
+    {
+    public:
+        explicit FrameArena(std::size_t capacity, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : m_upstream(upstream), m_overflow(upstream), m_capacity(capacity)
+        {
+            m_buffer = static_cast<std::byte*>(m_upstream->allocate(m_capacity, kBlockAlignment));
+        }
+
+        ~FrameArena() override
+        {
+            m_upstream->deallocate(m_buffer, m_capacity, kBlockAlignment);
+        }
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        // Invalidates everything allocated since the last reset.
+        void Reset() noexcept
+        {
+            m_used = 0;
+            m_overflowBytes = 0;
+            m_overflow.release();
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        std::size_t Capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        std::size_t Used() const noexcept
+        {
+            return m_used;
+        }
+
+        std::size_t OverflowBytes() const noexcept
+        {
+            return m_overflowBytes;
+        }
+
+        // Largest Used() + OverflowBytes() seen since construction.
+        std::size_t HighWaterMark() const noexcept
+        {
+            return m_highWaterMark;
+        }
+
+    private:
+        static constexpr std::size_t kBlockAlignment = alignof(std::max_align_t);
+
+        std::pmr::memory_resource* m_upstream;
+        std::pmr::monotonic_buffer_resource m_overflow;
+        std::byte* m_buffer = nullptr;
+        std::size_t m_capacity = 0;
+        std::size_t m_used = 0;
+        std::size_t m_overflowBytes = 0;
+        std::size_t m_highWaterMark = 0;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_buffer);
+            std::uintptr_t aligned = (base + m_used + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+            std::size_t offset = static_cast<std::size_t>(aligned - base);
+
+            void* result;
+            if (offset <= m_capacity && bytes <= m_capacity - offset)
+            {
+                m_used = offset + bytes;
+                result = m_buffer + offset;
+            }
+            else
+            {
+                result = m_overflow.allocate(bytes, alignment);
+                m_overflowBytes += bytes;
+            }
+
+            m_highWaterMark = std::max(m_highWaterMark, m_used + m_overflowBytes);
+            return result;
+        }
+
+        void do_deallocate(void*, std::size_t, std::size_t) noexcept override {}
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
@@ -0,0 +1,306 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <span>
+#include <vector>
+#include "MappedFile.h"
+#include "Quaternion.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    enum class ArrayElement : std::uint8_t
+    {
+        Vector2,
+        Vector3,
+        Quaternion
+    };
+
+    enum class ArrayPrecision : std::uint8_t
+    {
+        Float,
+        Double,
+        LongDouble
+    };
+
+    enum class ArrayLayout : std::uint8_t
+    {
+        AoS,
+        SoA
+    };
+
+    struct ArrayFileHeader
+    {
+        static constexpr char kMagic[8] = { 'V', 'E', 'C', '2', '3', 'A', 'R', 'R' };
+        static constexpr std::uint32_t kVersion = 1;
+        static constexpr std::uint64_t kAlignment = 64;
+
+        char magic[8];
+        std::uint32_t version;
+        ArrayElement element;
+        ArrayPrecision precision;
+        ArrayLayout layout;
+        std::uint8_t scalarSize;
+        std::uint64_t count;
+        std::uint64_t dataOffset;
+        std::uint64_t laneStride;
+        std::uint8_t reserved[24];
+
+        constexpr int LaneCount() const noexcept
+        {
+            switch (element)
+            {
+            case ArrayElement::Vector2: return 2;
+            case ArrayElement::Vector3: return 3;
+            default: return 4;
+            }
+        }
+    };
+
+    static_assert(sizeof(ArrayFileHeader) == ArrayFileHeader::kAlignment);
+
+    namespace Detail
+    {
+        template<typename Item>
+        struct ArrayElementOf;
+
+        template<std::floating_point T>
+        struct ArrayElementOf<Vector2<T>>
+        {
+            using Scalar = T;
+            static constexpr ArrayElement kElement = ArrayElement::Vector2;
+        };
+
+        template<std::floating_point T>
+        struct ArrayElementOf<Vector3<T>>
+        {
+            using Scalar = T;
+            static constexpr ArrayElement kElement = ArrayElement::Vector3;
+        };
+
+        template<std::floating_point T>
+        struct ArrayElementOf<Quaternion<T>>
+        {
+            using Scalar = T;
+            static constexpr ArrayElement kElement = ArrayElement::Quaternion;
+        };
+    }
+
+    struct ArrayFile
+    {
+        template<std::ranges::contiguous_range Range>
+            requires requires { Detail::ArrayElementOf<std::ranges::range_value_t<Range>>::kElement; }
+        static bool Write(const std::filesystem::path& path, const Range& items, ArrayLayout layout = ArrayLayout::AoS)
+        {
+            using Item = std::ranges::range_value_t<Range>;
+            return WriteItems(path, std::span<const Item>(std::ranges::data(items), std::ranges::size(items)), layout);
+        }
+
+        template<std::floating_point T>
+        static constexpr ArrayPrecision PrecisionOf() noexcept
+        {
+            return std::same_as<T, float> ? ArrayPrecision::Float :
+                std::same_as<T, double> ? ArrayPrecision::Double :
+                ArrayPrecision::LongDouble;
+        }
+
+        static constexpr std::uint64_t AlignUp(std::uint64_t value) noexcept
+        {
+            return (value + ArrayFileHeader::kAlignment - 1) & ~(ArrayFileHeader::kAlignment - 1);
+        }
+
+    private:
+        template<typename Item>
+        static bool WriteItems(const std::filesystem::path& path, std::span<const Item> items, ArrayLayout layout)
+        {
+            using T = typename Detail::ArrayElementOf<Item>::Scalar;
+
+            ArrayFileHeader header = {};
+            std::memcpy(header.magic, ArrayFileHeader::kMagic, sizeof(header.magic));
+            header.version = ArrayFileHeader::kVersion;
+            header.element = Detail::ArrayElementOf<Item>::kElement;
+            header.precision = PrecisionOf<T>();
+            header.layout = layout;
+            header.scalarSize = static_cast<std::uint8_t>(sizeof(T));
+            header.count = items.size();
+            header.dataOffset = AlignUp(sizeof(ArrayFileHeader));
+            header.laneStride = (layout == ArrayLayout::SoA) ? AlignUp(items.size() * sizeof(T)) : 0;
+
+            std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            if (layout == ArrayLayout::AoS)
+            {
+                stream.write(reinterpret_cast<const char*>(items.data()), items.size_bytes());
+            }
+            else
+            {
+                constexpr std::size_t kBatch = 4096;
+                const char padding[ArrayFileHeader::kAlignment] = {};
+                std::vector<T> lane(std::min(items.size(), kBatch));
+
+                for (int l = 0; l < header.LaneCount(); ++l)
+                {
+                    for (std::size_t begin = 0; begin < items.size(); begin += kBatch)
+                    {
+                        std::size_t end = std::min(begin + kBatch, items.size());
+                        for (std::size_t i = begin; i < end; ++i)
+                        {
+                            lane[i - begin] = reinterpret_cast<const T*>(&items[i])[l];
+                        }
+                        stream.write(reinterpret_cast<const char*>(lane.data()), (end - begin) * sizeof(T));
+                    }
+                    stream.write(padding, header.laneStride - items.size() * sizeof(T));
+                }
+            }
+
+            return static_cast<bool>(stream.flush());
+        }
+    };
+
+    class MappedArrayFile
+    {
+    public:
+        MappedArrayFile() noexcept = default;
+
+        explicit MappedArrayFile(const std::filesystem::path& path) noexcept
+        {
+            Open(path);
+        }
+
+        bool Open(const std::filesystem::path& path) noexcept
+        {
+            if (!m_file.Open(path) || !IsValid())
+            {
+                m_file.Close();
+                return false;
+            }
+
+            return true;
+        }
+
+        void Close() noexcept
+        {
+            m_file.Close();
+        }
+
+        bool IsOpen() const noexcept
+        {
+            return m_file.IsOpen();
+        }
+
+        const ArrayFileHeader& Header() const noexcept
+        {
+            assert(IsOpen());
+            return *reinterpret_cast<const ArrayFileHeader*>(Bytes());
+        }
+
+        template<std::floating_point T>
+        std::span<const Vector2<T>> Vector2s() const noexcept
+        {
+            return Items<Vector2<T>, T>(ArrayElement::Vector2);
+        }
+
+        template<std::floating_point T>
+        std::span<const Vector3<T>> Vector3s() const noexcept
+        {
+            return Items<Vector3<T>, T>(ArrayElement::Vector3);
+        }
+
+        template<std::floating_point T>
+        std::span<const Quaternion<T>> Quaternions() const noexcept
+        {
+            return Items<Quaternion<T>, T>(ArrayElement::Quaternion);
+        }
+
+        template<std::floating_point T>
+        std::span<const T> Lane(int index) const noexcept
+        {
+            if (!Matches<T>(ArrayLayout::SoA) || index < 0 || index >= Header().LaneCount())
+            {
+                return {};
+            }
+
+            const std::byte* lane = Bytes() + Header().dataOffset + Header().laneStride * static_cast<std::uint64_t>(index);
+            return { reinterpret_cast<const T*>(lane), static_cast<std::size_t>(Header().count) };
+        }
+
+    private:
+        MappedFile m_file;
+
+        const std::byte* Bytes() const noexcept
+        {
+            return m_file.Bytes().data();
+        }
+
+        bool IsValid() const noexcept
+        {
+            std::size_t size = m_file.Bytes().size();
+            if (size < sizeof(ArrayFileHeader))
+            {
+                return false;
+            }
+
+            const ArrayFileHeader& header = Header();
+            if (std::memcmp(header.magic, ArrayFileHeader::kMagic, sizeof(header.magic)) != 0 ||
+                header.version != ArrayFileHeader::kVersion ||
+                header.element > ArrayElement::Quaternion ||
+                header.precision > ArrayPrecision::LongDouble ||
+                header.layout > ArrayLayout::SoA ||
+                header.dataOffset % ArrayFileHeader::kAlignment != 0 ||
+                header.count > size)
+            {
+                return false;
+            }
+
+            if (header.dataOffset > size)
+            {
+                return false;
+            }
+
+            // Divided rather than multiplied out, so a hostile count or lane stride cannot wrap the payload size.
+            std::uint64_t available = size - header.dataOffset;
+            std::uint64_t laneBytes = header.count * header.scalarSize;
+            std::uint64_t lanes = static_cast<std::uint64_t>(header.LaneCount());
+            if (header.layout == ArrayLayout::AoS)
+            {
+                return laneBytes <= available / lanes;
+            }
+
+            return header.laneStride % ArrayFileHeader::kAlignment == 0 &&
+                header.laneStride >= laneBytes && laneBytes <= available &&
+                header.laneStride <= (available - laneBytes) / (lanes - 1);
+        }
+
+        template<std::floating_point T>
+        bool Matches(ArrayLayout layout) const noexcept
+        {
+            return IsOpen() &&
+                Header().layout == layout &&
+                Header().precision == ArrayFile::PrecisionOf<T>() &&
+                Header().scalarSize == sizeof(T);
+        }
+
+        template<typename Item, std::floating_point T>
+        std::span<const Item> Items(ArrayElement element) const noexcept
+        {
+            if (!Matches<T>(ArrayLayout::AoS) || Header().element != element)
+            {
+                return {};
+            }
+
+            return { reinterpret_cast<const Item*>(Bytes() + Header().dataOffset), static_cast<std::size_t>(Header().count) };
+        }
+    };
+}
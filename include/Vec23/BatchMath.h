@@ -0,0 +1,148 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include "Constants.h"
+
+// Branch-free polynomial trig for batch loops. Unlike libm calls, these inline into the loop body and
+// leave only arithmetic and selects, so the compiler can vectorize the surrounding loop. GCC only
+// if-converts the selects in BatchAtan2 and BatchAsin under -fno-trapping-math -fno-math-errno.
+namespace Vec23::Detail
+{
+    // Elements per tile when batch loops stage intermediates in local arrays.
+    inline constexpr std::size_t kBatchTile = 128;
+
+    template<std::floating_point T>
+    inline constexpr std::size_t kSinCosTerms =
+        std::same_as<T, float> ? 6 :
+        std::same_as<T, double> ? 9 :
+        11;
+
+    template<std::floating_point T>
+    inline constexpr std::size_t kAtanTerms =
+        std::same_as<T, float> ? 9 :
+        std::same_as<T, double> ? 20 :
+        25;
+
+    // Taylor coefficients in r^2, starting from the constant term.
+    template<std::floating_point T, std::size_t N>
+    constexpr std::array<T, N> MakeSeries(bool odd) noexcept
+    {
+        std::array<T, N> result{};
+        long double factorial = 1.0L;
+        for (std::size_t n = 0; n < N; ++n)
+        {
+            if (n > 0)
+            {
+                factorial *= static_cast<long double>((2 * n - (odd ? 0 : 1)) * (2 * n + (odd ? 1 : 0)));
+            }
+            result[n] = static_cast<T>(((n % 2 == 0) ? 1.0L : -1.0L) / factorial);
+        }
+        return result;
+    }
+
+    template<std::floating_point T, std::size_t N>
+    constexpr std::array<T, N> MakeAtanSeries() noexcept
+    {
+        std::array<T, N> result{};
+        for (std::size_t n = 0; n < N; ++n)
+        {
+            result[n] = static_cast<T>(((n % 2 == 0) ? 1.0L : -1.0L) / static_cast<long double>(2 * n + 1));
+        }
+        return result;
+    }
+
+    template<std::floating_point T>
+    inline constexpr auto kSinSeries = MakeSeries<T, kSinCosTerms<T>>(true);
+
+    template<std::floating_point T>
+    inline constexpr auto kCosSeries = MakeSeries<T, kSinCosTerms<T>>(false);
+
+    template<std::floating_point T>
+    inline constexpr auto kAtanSeries = MakeAtanSeries<T, kAtanTerms<T>>();
+
+    // Unrolled at compile time, so the coefficients become immediate constants in the loop body.
+    template<std::floating_point T, std::size_t N>
+    constexpr T Horner(const std::array<T, N>& coefficients, T x) noexcept
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            T result = coefficients[N - 1];
+            ((result = result * x + coefficients[N - 2 - I]), ...);
+            return result;
+        }(std::make_index_sequence<N - 1>());
+    }
+
+    // The reduction to [-45, 45] degrees happens in degrees, where subtracting multiples of 90 is exact.
+    // The quadrant is taken modulo 4 before the integer conversion, which is exact for every finite value;
+    // NaN and infinite angles map to quadrant 0 and come out as NaN through r.
+    template<std::floating_point T>
+    inline void BatchSinCos(T degrees, T& outSin, T& outCos) noexcept
+    {
+        T quadrant = std::nearbyint(degrees * (kOne<T> / T(90)));
+        T r = (degrees - quadrant * T(90)) * kDegreesToRadians<T>;
+        T r2 = r * r;
+
+        T s = r * Horner(kSinSeries<T>, r2);
+        T c = Horner(kCosSeries<T>, r2);
+
+        T wrapped = quadrant - T(4) * std::trunc(quadrant * T(0.25));
+        wrapped = (wrapped == wrapped) ? wrapped : kZero<T>;
+        std::int32_t q = static_cast<std::int32_t>(wrapped) & 3;
+        T sinT = (q & 1) ? c : s;
+        T cosT = (q & 1) ? s : c;
+        outSin = (q & 2) ? -sinT : sinT;
+        outCos = ((q + 1) & 2) ? -cosT : cosT;
+    }
+
+    // std::lerp's exactness and monotonicity cases, written as selects so it can sit in a vectorized loop.
+    template<std::floating_point T>
+    inline T BatchLerp(T a, T b, T t) noexcept
+    {
+        bool straddles = ((a <= kZero<T>) & (b >= kZero<T>)) | ((a >= kZero<T>) & (b <= kZero<T>));
+        T mixed = t * b + (kOne<T> - t) * a;
+        T x = a + t * (b - a);
+        T bounded = ((t > kOne<T>) == (b > a)) ? (b < x ? x : b) : (b > x ? x : b);
+        bounded = (t == kOne<T>) ? b : bounded;
+        return straddles ? mixed : bounded;
+    }
+
+    // Every quadrant and octant fix-up is written as a select between constants followed by
+    // unconditional arithmetic, so the whole body if-converts even under -ftrapping-math.
+    template<std::floating_point T>
+    inline T BatchAtan2(T y, T x) noexcept
+    {
+        constexpr T kTanEighthPi = T(0.41421356237309504880168872420969808L);
+
+        T ax = std::abs(x);
+        T ay = std::abs(y);
+        bool steep = ay > ax;
+        T high = steep ? ay : ax;
+        T low = steep ? ax : ay;
+        T a = low / ((high > kZero<T>) ? high : std::numeric_limits<T>::min());
+
+        // Shift [tan(pi/8), 1] down to [-tan(pi/8), 0] so the series converges quickly.
+        T shift = (a > kTanEighthPi) ? kOne<T> : kZero<T>;
+        T reduced = (a - shift) / (a * shift + kOne<T>);
+        T angle = reduced * Horner(kAtanSeries<T>, reduced * reduced) + shift * kPi<T> * T(0.25);
+
+        angle = (steep ? kPi<T> * kHalf<T> : kZero<T>) + (steep ? -kOne<T> : kOne<T>) * angle;
+        angle = (x < kZero<T> ? kPi<T> : kZero<T>) + (x < kZero<T> ? -kOne<T> : kOne<T>) * angle;
+        return (y < kZero<T> ? -kOne<T> : kOne<T>) * angle;
+    }
+
+    template<std::floating_point T>
+    inline T BatchAsin(T v) noexcept
+    {
+        v = (v > kOne<T>) ? kOne<T> : v;
+        v = (v < -kOne<T>) ? -kOne<T> : v;
+        return BatchAtan2(v, std::sqrt(kOne<T> - v * v));
+    }
+}
@@ -0,0 +1,110 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Vec23::Detail
+{
+    constexpr std::uint64_t ZigZag(std::int64_t value) noexcept
+    {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    constexpr std::int64_t UnZigZag(std::uint64_t value) noexcept
+    {
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    constexpr std::uint64_t LowBits(std::uint64_t value, int width) noexcept
+    {
+        return (width >= 64) ? value : value & ((std::uint64_t(1) << width) - 1);
+    }
+
+    class BitWriter
+    {
+    public:
+        explicit BitWriter(std::vector<std::uint64_t>& words) noexcept : m_words(words) {}
+
+        void Write(std::uint64_t value, int width)
+        {
+            m_buffer |= value << m_used;
+            if (m_used + width >= 64)
+            {
+                m_words.push_back(m_buffer);
+                m_buffer = (m_used == 0) ? 0 : value >> (64 - m_used);
+                m_used += width - 64;
+            }
+            else
+            {
+                m_used += width;
+            }
+        }
+
+        void Flush()
+        {
+            if (m_used > 0)
+            {
+                m_words.push_back(m_buffer);
+                m_buffer = 0;
+                m_used = 0;
+            }
+        }
+
+    private:
+        std::vector<std::uint64_t>& m_words;
+        std::uint64_t m_buffer = 0;
+        int m_used = 0;
+    };
+
+    class BitReader
+    {
+    public:
+        BitReader(const std::byte* words, std::size_t wordCount) noexcept : m_words(words), m_wordCount(wordCount) {}
+
+        std::uint64_t Read(int width) noexcept
+        {
+            if (m_available >= width)
+            {
+                std::uint64_t value = LowBits(m_buffer, width);
+                m_buffer = (width >= 64) ? 0 : m_buffer >> width;
+                m_available -= width;
+                return value;
+            }
+
+            std::uint64_t fresh = 0;
+            if (m_next < m_wordCount)
+            {
+                std::memcpy(&fresh, m_words + m_next * sizeof(std::uint64_t), sizeof(fresh));
+                ++m_next;
+            }
+
+            std::uint64_t value = LowBits((m_available == 0) ? fresh : m_buffer | (fresh << m_available), width);
+            int consumed = width - m_available;
+            m_buffer = (consumed >= 64) ? 0 : fresh >> consumed;
+            m_available = 64 - consumed;
+            return value;
+        }
+
+    private:
+        const std::byte* m_words;
+        std::size_t m_wordCount;
+        std::size_t m_next = 0;
+        std::uint64_t m_buffer = 0;
+        int m_available = 0;
+    };
+
+    // Random access to a field of fewer than 64 bits that may straddle two words. The word after the field is
+    // always read, so streams accessed this way end with a padding word.
+    inline std::uint64_t ExtractBits(const std::uint64_t* words, std::size_t offset, int width) noexcept
+    {
+        std::size_t index = offset / 64;
+        int shift = static_cast<int>(offset % 64);
+        std::uint64_t low = words[index] >> shift;
+        std::uint64_t high = (words[index + 1] << 1) << (63 - shift);
+        return LowBits(low | high, width);
+    }
+}
@@ -0,0 +1,295 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include "Constants.h"
+#include "Parallel.h"
+#include "PointCloud.h"
+#include "Quaternion.h"
+#include "StridedView.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    template<std::floating_point T>
+    struct BoundingSphere
+    {
+        Vector3<T> center;
+        T radius;
+
+        constexpr BoundingSphere() noexcept : center(), radius(kZero<T>) {}
+
+        constexpr BoundingSphere(const Vector3<T>& center, T radius) noexcept : center(center), radius(radius) {}
+
+        static BoundingSphere FromPoints(std::span<const Vector3<T>> points)
+        {
+            return FromPointsOf(points);
+        }
+
+        static BoundingSphere FromPoints(ConstVector3View<T> points)
+        {
+            return FromPointsOf(points);
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        void Grow(const Vector3<T>& p) noexcept
+        {
+            T distanceSq = Vector3<T>::DistanceSquared(center, p);
+            if (distanceSq > radius * radius)
+            {
+                T distance = std::sqrt(distanceSq);
+                T newRadius = (radius + distance) * kHalf<T>;
+                center += (p - center) * ((newRadius - radius) / distance);
+                radius = newRadius;
+            }
+        }
+
+        bool Contains(const Vector3<T>& p, T epsilon = kToleranceEpsilon<T>) const noexcept
+        {
+            T limit = radius + epsilon;
+            return Vector3<T>::DistanceSquared(center, p) <= limit * limit;
+        }
+
+    private:
+        static constexpr int kNormalCount = 13;
+        static constexpr int kGrowIterations = 16;
+
+        template<typename Points>
+        static BoundingSphere FromPointsOf(const Points& points)
+        {
+            if (points.empty())
+            {
+                return {};
+            }
+
+            // EPOS-26: seed the sphere with the most distant pair of extremal points along 13 directions.
+            Extremes extremes = Detail::ParallelReduce(points.size(), Extremes{}, [&](std::size_t begin, std::size_t end)
+            {
+                Extremes partial;
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    partial.Add(points[i], i);
+                }
+                return partial;
+            }, Extremes::Combine);
+
+            BoundingSphere sphere;
+            T bestDistanceSq = -kOne<T>;
+            for (int n = 0; n < kNormalCount; ++n)
+            {
+                const Vector3<T>& a = points[extremes.minIndex[n]];
+                const Vector3<T>& b = points[extremes.maxIndex[n]];
+                T distanceSq = Vector3<T>::DistanceSquared(a, b);
+                if (distanceSq > bestDistanceSq)
+                {
+                    bestDistanceSq = distanceSq;
+                    sphere.center = (a + b) * kHalf<T>;
+                    sphere.radius = std::sqrt(distanceSq) * kHalf<T>;
+                }
+            }
+
+            // Ritter growth, one parallel farthest-point pass per step.
+            for (int iteration = 0; iteration < kGrowIterations; ++iteration)
+            {
+                Farthest farthest = Detail::ParallelReduce(points.size(), Farthest{}, [&](std::size_t begin, std::size_t end)
+                {
+                    Farthest partial;
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        T distanceSq = Vector3<T>::DistanceSquared(sphere.center, points[i]);
+                        if (distanceSq > partial.distanceSq)
+                        {
+                            partial.distanceSq = distanceSq;
+                            partial.index = i;
+                        }
+                    }
+                    return partial;
+                }, [](const Farthest& a, const Farthest& b) { return b.distanceSq > a.distanceSq ? b : a; });
+
+                if (farthest.distanceSq <= sphere.radius * sphere.radius)
+                {
+                    return sphere;
+                }
+
+                sphere.Grow(points[farthest.index]);
+            }
+
+            for (const Vector3<T>& p : points)
+            {
+                sphere.Grow(p);
+            }
+
+            return sphere;
+        }
+
+        static constexpr Vector3<T> kNormals[kNormalCount] =
+        {
+            { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 },
+            { 1, 1, 0 }, { 1, -1, 0 }, { 1, 0, 1 }, { 1, 0, -1 }, { 0, 1, 1 }, { 0, 1, -1 },
+            { 1, 1, 1 }, { 1, -1, 1 }, { 1, 1, -1 }, { 1, -1, -1 }
+        };
+
+        struct Extremes
+        {
+            T minValue[kNormalCount];
+            T maxValue[kNormalCount];
+            std::size_t minIndex[kNormalCount] = {};
+            std::size_t maxIndex[kNormalCount] = {};
+
+            constexpr Extremes() noexcept
+            {
+                std::fill(minValue, minValue + kNormalCount, std::numeric_limits<T>::infinity());
+                std::fill(maxValue, maxValue + kNormalCount, -std::numeric_limits<T>::infinity());
+            }
+
+            constexpr void Add(const Vector3<T>& p, std::size_t index) noexcept
+            {
+                for (int n = 0; n < kNormalCount; ++n)
+                {
+                    T projection = p.Dot(kNormals[n]);
+                    if (projection < minValue[n])
+                    {
+                        minValue[n] = projection;
+                        minIndex[n] = index;
+                    }
+                    if (projection > maxValue[n])
+                    {
+                        maxValue[n] = projection;
+                        maxIndex[n] = index;
+                    }
+                }
+            }
+
+            static constexpr Extremes Combine(const Extremes& a, const Extremes& b) noexcept
+            {
+                Extremes result = a;
+                for (int n = 0; n < kNormalCount; ++n)
+                {
+                    if (b.minValue[n] < result.minValue[n])
+                    {
+                        result.minValue[n] = b.minValue[n];
+                        result.minIndex[n] = b.minIndex[n];
+                    }
+                    if (b.maxValue[n] > result.maxValue[n])
+                    {
+                        result.maxValue[n] = b.maxValue[n];
+                        result.maxIndex[n] = b.maxIndex[n];
+                    }
+                }
+                return result;
+            }
+        };
+
+        struct Farthest
+        {
+            T distanceSq = -kOne<T>;
+            std::size_t index = 0;
+        };
+    };
+
+    template<std::floating_point T>
+    struct OrientedBox
+    {
+        Vector3<T> center;
+        Quaternion<T> rotation;
+        Vector3<T> extents;
+
+        constexpr OrientedBox() noexcept = default;
+
+        constexpr OrientedBox(const Vector3<T>& center, const Quaternion<T>& rotation, const Vector3<T>& extents) noexcept
+            : center(center), rotation(rotation), extents(extents) {}
+
+        static OrientedBox FromPoints(std::span<const Vector3<T>> points)
+        {
+            return points.empty() ? OrientedBox() : FromPointsOf(points, PointCloud<T>::PrincipalAxes(points));
+        }
+
+        static OrientedBox FromPoints(ConstVector3View<T> points)
+        {
+            return points.empty() ? OrientedBox() : FromPointsOf(points, PointCloud<T>::PrincipalAxes(points));
+        }
+
+        static OrientedBox FromPoints(std::span<const Vector3<T>> points, const Quaternion<T>& rotation)
+        {
+            return FromPointsOf(points, rotation);
+        }
+
+        static OrientedBox FromPoints(ConstVector3View<T> points, const Quaternion<T>& rotation)
+        {
+            return FromPointsOf(points, rotation);
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        bool Contains(const Vector3<T>& p, T epsilon = kToleranceEpsilon<T>) const noexcept
+        {
+            Vector3<T> local = rotation.GetConjugated().RotateVector(p - center);
+            return std::abs(local.x) <= extents.x + epsilon &&
+                std::abs(local.y) <= extents.y + epsilon &&
+                std::abs(local.z) <= extents.z + epsilon;
+        }
+
+        constexpr T Volume() const noexcept
+        {
+            return T(8) * extents.x * extents.y * extents.z;
+        }
+
+    private:
+        template<typename Points>
+        static OrientedBox FromPointsOf(const Points& points, const Quaternion<T>& rotation)
+        {
+            if (points.empty())
+            {
+                return {};
+            }
+
+            Quaternion<T> inverse = rotation.GetConjugated();
+            Range range = Detail::ParallelReduce(points.size(), Range{}, [&](std::size_t begin, std::size_t end)
+            {
+                Range partial;
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    Vector3<T> local = inverse.RotateVector(points[i]);
+                    partial.min = { std::min(partial.min.x, local.x), std::min(partial.min.y, local.y), std::min(partial.min.z, local.z) };
+                    partial.max = { std::max(partial.max.x, local.x), std::max(partial.max.y, local.y), std::max(partial.max.z, local.z) };
+                }
+                return partial;
+            }, Range::Combine);
+
+            return { rotation.RotateVector((range.min + range.max) * kHalf<T>), rotation, (range.max - range.min) * kHalf<T> };
+        }
+
+        struct Range
+        {
+            Vector3<T> min = Vector3<T>(std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity());
+            Vector3<T> max = -min;
+
+            static constexpr Range Combine(const Range& a, const Range& b) noexcept
+            {
+                Range result;
+                result.min = { std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z) };
+                result.max = { std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z) };
+                return result;
+            }
+        };
+    };
+
+    using FBoundingSphere = BoundingSphere<float>;
+    using DBoundingSphere = BoundingSphere<double>;
+    using LDBoundingSphere = BoundingSphere<long double>;
+
+    using FOrientedBox = OrientedBox<float>;
+    using DOrientedBox = OrientedBox<double>;
+    using LDOrientedBox = OrientedBox<long double>;
+}
@@ -0,0 +1,268 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <vector>
+#include "Constants.h"
+#include "Parallel.h"
+#include "Quaternion.h"
+#include "SoA.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    // Elements that changed between two frames, both as a bitmask (bit i of word i / 64) and as an
+    // ascending index list.
+    class ChangeSet
+    {
+    public:
+        static constexpr std::size_t kWordBits = 64;
+
+        ChangeSet() = default;
+
+        explicit ChangeSet(std::pmr::memory_resource* resource) : m_words(resource), m_indices(resource) {}
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        std::size_t Size() const noexcept
+        {
+            return m_size;
+        }
+
+        std::size_t DirtyCount() const noexcept
+        {
+            return m_indices.size();
+        }
+
+        bool IsDirty(std::size_t index) const noexcept
+        {
+            assert(index < m_size);
+            return (m_words[index / kWordBits] >> (index % kWordBits)) & 1;
+        }
+
+        std::span<const std::uint64_t> Words() const noexcept
+        {
+            return m_words;
+        }
+
+        std::span<const std::uint32_t> Indices() const noexcept
+        {
+            return m_indices;
+        }
+
+    private:
+        template<std::floating_point>
+        friend struct ChangeDetection;
+
+        std::pmr::vector<std::uint64_t> m_words;
+        std::pmr::vector<std::uint32_t> m_indices;
+        std::size_t m_size = 0;
+    };
+
+    // Batch IsNearlyEqual: an element is dirty exactly when previous[i].IsNearlyEqual(current[i], epsilon)
+    // is false. Tolerances are either one epsilon for all elements or one per element.
+    template<std::floating_point T>
+    struct ChangeDetection
+    {
+        static void Compare(std::span<const Vector3<T>> previous, std::span<const Vector3<T>> current, ChangeSet& out,
+            T epsilon = kToleranceEpsilon<T>)
+        {
+            assert(previous.size() == current.size());
+            Detect(current.size(), out, [&](std::size_t i)
+            {
+                const Vector3<T>& a = previous[i];
+                const Vector3<T>& b = current[i];
+                return Vector3Changed(a.x, a.y, a.z, b.x, b.y, b.z, epsilon);
+            });
+        }
+
+        static void Compare(std::span<const Vector3<T>> previous, std::span<const Vector3<T>> current, ChangeSet& out,
+            std::span<const T> epsilons)
+        {
+            assert(previous.size() == current.size() && epsilons.size() == current.size());
+            Detect(current.size(), out, [&](std::size_t i)
+            {
+                const Vector3<T>& a = previous[i];
+                const Vector3<T>& b = current[i];
+                return Vector3Changed(a.x, a.y, a.z, b.x, b.y, b.z, epsilons[i]);
+            });
+        }
+
+        static void Compare(const Vector3SoA<T>& previous, const Vector3SoA<T>& current, ChangeSet& out,
+            T epsilon = kToleranceEpsilon<T>)
+        {
+            CompareColumns(previous, current, out, [epsilon](std::size_t) { return epsilon; });
+        }
+
+        static void Compare(const Vector3SoA<T>& previous, const Vector3SoA<T>& current, ChangeSet& out,
+            std::span<const T> epsilons)
+        {
+            assert(epsilons.size() == current.Size());
+            CompareColumns(previous, current, out, [e = epsilons.data()](std::size_t i) { return e[i]; });
+        }
+
+        static void Compare(std::span<const Quaternion<T>> previous, std::span<const Quaternion<T>> current, ChangeSet& out,
+            T epsilon = kSafetyEpsilon<T>)
+        {
+            assert(previous.size() == current.size());
+            Detect(current.size(), out, [&](std::size_t i)
+            {
+                const Quaternion<T>& a = previous[i];
+                const Quaternion<T>& b = current[i];
+                return QuaternionChanged(a.w, a.x, a.y, a.z, b.w, b.x, b.y, b.z, epsilon);
+            });
+        }
+
+        static void Compare(std::span<const Quaternion<T>> previous, std::span<const Quaternion<T>> current, ChangeSet& out,
+            std::span<const T> epsilons)
+        {
+            assert(previous.size() == current.size() && epsilons.size() == current.size());
+            Detect(current.size(), out, [&](std::size_t i)
+            {
+                const Quaternion<T>& a = previous[i];
+                const Quaternion<T>& b = current[i];
+                return QuaternionChanged(a.w, a.x, a.y, a.z, b.w, b.x, b.y, b.z, epsilons[i]);
+            });
+        }
+
+        static void Compare(const QuaternionSoA<T>& previous, const QuaternionSoA<T>& current, ChangeSet& out,
+            T epsilon = kSafetyEpsilon<T>)
+        {
+            CompareColumns(previous, current, out, [epsilon](std::size_t) { return epsilon; });
+        }
+
+        static void Compare(const QuaternionSoA<T>& previous, const QuaternionSoA<T>& current, ChangeSet& out,
+            std::span<const T> epsilons)
+        {
+            assert(epsilons.size() == current.Size());
+            CompareColumns(previous, current, out, [e = epsilons.data()](std::size_t i) { return e[i]; });
+        }
+
+    private:
+        // Same arithmetic, in the same order, as Vector3::IsNearlyEqual.
+        static bool Vector3Changed(T ax, T ay, T az, T bx, T by, T bz, T epsilon) noexcept
+        {
+            T dx = bx - ax;
+            T dy = by - ay;
+            T dz = bz - az;
+            return !(((dx * dx) + (dy * dy) + (dz * dz)) < (epsilon * epsilon));
+        }
+
+        // Same arithmetic as Quaternion::IsNearlyEqual. Its degenerate branch is folded into bitwise logic
+        // rather than short-circuit operators, so the loop has no control flow to keep it scalar.
+        static bool QuaternionChanged(T aw, T ax, T ay, T az, T bw, T bx, T by, T bz, T epsilon) noexcept
+        {
+            T lenSqA = (aw * aw) + (ax * ax) + (ay * ay) + (az * az);
+            T lenSqB = (bw * bw) + (bx * bx) + (by * by) + (bz * bz);
+            T dot = (aw * bw) + (ax * bx) + (ay * by) + (az * bz);
+
+            bool degenerateA = lenSqA < kSafetyEpsilon<T>;
+            bool degenerateB = lenSqB < kSafetyEpsilon<T>;
+            bool close = std::abs(dot * dot - lenSqA * lenSqB) <= epsilon;
+            bool either = degenerateA | degenerateB;
+            bool both = degenerateA & degenerateB;
+            return (either & !both) | (!either & !close);
+        }
+
+        template<typename Epsilon>
+        static void CompareColumns(const Vector3SoA<T>& previous, const Vector3SoA<T>& current, ChangeSet& out, Epsilon epsilon)
+        {
+            assert(previous.Size() == current.Size());
+            const T* ax = previous.x.data();
+            const T* ay = previous.y.data();
+            const T* az = previous.z.data();
+            const T* bx = current.x.data();
+            const T* by = current.y.data();
+            const T* bz = current.z.data();
+            Detect(current.Size(), out, [=](std::size_t i)
+            {
+                return Vector3Changed(ax[i], ay[i], az[i], bx[i], by[i], bz[i], epsilon(i));
+            });
+        }
+
+        template<typename Epsilon>
+        static void CompareColumns(const QuaternionSoA<T>& previous, const QuaternionSoA<T>& current, ChangeSet& out, Epsilon epsilon)
+        {
+            assert(previous.Size() == current.Size());
+            const T* aw = previous.w.data();
+            const T* ax = previous.x.data();
+            const T* ay = previous.y.data();
+            const T* az = previous.z.data();
+            const T* bw = current.w.data();
+            const T* bx = current.x.data();
+            const T* by = current.y.data();
+            const T* bz = current.z.data();
+            Detect(current.Size(), out, [=](std::size_t i)
+            {
+                return QuaternionChanged(aw[i], ax[i], ay[i], az[i], bw[i], bx[i], by[i], bz[i], epsilon(i));
+            });
+        }
+
+        // Two passes over ParallelFor chunks, which always start on a word boundary: the first builds the mask
+        // and counts dirty bits per chunk, the second expands each chunk's words at its offset in the index list.
+        template<typename Changed>
+        static void Detect(std::size_t count, ChangeSet& out, Changed changed)
+        {
+            static_assert(Detail::kParallelGrain % ChangeSet::kWordBits == 0);
+            assert(count <= std::numeric_limits<std::uint32_t>::max());
+
+            constexpr std::size_t kBits = ChangeSet::kWordBits;
+            std::pmr::memory_resource* resource = out.m_words.get_allocator().resource();
+            out.m_size = count;
+            out.m_words.assign((count + kBits - 1) / kBits, 0);
+
+            std::uint64_t* words = out.m_words.data();
+
+            std::pmr::vector<std::size_t> offsets(Detail::ChunkCount(count) + 1, 0, resource);
+            Detail::ParallelFor(count, [&](std::size_t begin, std::size_t end)
+            {
+                std::size_t dirty = 0;
+                for (std::size_t first = begin; first < end; first += kBits)
+                {
+                    std::size_t bits = std::min(kBits, end - first);
+                    std::uint64_t word = 0;
+                    for (std::size_t j = 0; j < bits; ++j)
+                    {
+                        word |= static_cast<std::uint64_t>(changed(first + j)) << j;
+                    }
+                    words[first / kBits] = word;
+                    dirty += static_cast<std::size_t>(std::popcount(word));
+                }
+                offsets[begin / Detail::kParallelGrain + 1] = dirty;
+            }, resource);
+
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+            out.m_indices.resize(offsets.back());
+            std::uint32_t* indices = out.m_indices.data();
+
+            Detail::ParallelFor(count, [&](std::size_t begin, std::size_t end)
+            {
+                std::size_t cursor = offsets[begin / Detail::kParallelGrain];
+                for (std::size_t first = begin; first < end; first += kBits)
+                {
+                    for (std::uint64_t word = words[first / kBits]; word != 0; word &= word - 1)
+                    {
+                        indices[cursor++] = static_cast<std::uint32_t>(first + static_cast<std::size_t>(std::countr_zero(word)));
+                    }
+                }
+            }, resource);
+        }
+    };
+
+    using FChangeDetection = ChangeDetection<float>;
+    using DChangeDetection = ChangeDetection<double>;
+    using LDChangeDetection = ChangeDetection<long double>;
+}
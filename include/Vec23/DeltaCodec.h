@@ -0,0 +1,334 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+#include "BitPacking.h"
+#include "Constants.h"
+#include "Parallel.h"
+#include "RigidTransform.h"
+#include "SoA.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    // Grid cells produced by Vector3DeltaCodec::Quantize, one column per axis.
+    struct QuantizedVector3SoA
+    {
+        std::vector<std::uint32_t> x;
+        std::vector<std::uint32_t> y;
+        std::vector<std::uint32_t> z;
+
+        void Resize(std::size_t size)
+        {
+            x.resize(size);
+            y.resize(size);
+            z.resize(size);
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return x.size();
+        }
+
+        bool IsEmpty() const noexcept
+        {
+            return x.empty();
+        }
+    };
+
+    // Replication codec for positions. Positions are moved into a reference frame, snapped to a grid of
+    // the given precision inside the frame's bounds, and encoded as differences from a baseline the
+    // receiver already holds (or as absolute cells for a key frame). Each block of kBlockSize elements
+    // stores one bit width per axis, the widest zigzagged difference it contains, so entities that did
+    // not move cost nothing beyond the 18-bit block header.
+    //
+    // Stream layout, in 64-bit words: a header word holding the element count with bit 63 set for delta
+    // frames, the bit-packed blocks, and one padding word. Within a block each axis is stored as a run of
+    // fixed-width fields, so decoding is a branch-free extraction at computed offsets.
+    template<std::floating_point T>
+    class Vector3DeltaCodec
+    {
+    public:
+        static constexpr std::size_t kBlockSize = 64;
+
+        Vector3DeltaCodec(const Vector3<T>& boundsMin, const Vector3<T>& boundsMax, T precision,
+            const RigidTransform<T>& frame = {}) noexcept
+            : m_frame(frame), m_toLocal(frame.GetInversed()), m_min(boundsMin), m_precision(precision),
+              m_invPrecision(kOne<T> / precision)
+        {
+            assert(precision > kZero<T>);
+            Vector3<T> cells = (boundsMax - boundsMin) * m_invPrecision;
+            m_maxCell = { std::ceil(cells.x), std::ceil(cells.y), std::ceil(cells.z) };
+            assert(m_maxCell.x >= kZero<T> && m_maxCell.y >= kZero<T> && m_maxCell.z >= kZero<T>);
+            assert(std::max({ m_maxCell.x, m_maxCell.y, m_maxCell.z }) <= static_cast<T>(std::numeric_limits<std::int32_t>::max()));
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        T Precision() const noexcept
+        {
+            return m_precision;
+        }
+
+        // Bits per axis of an absolute cell, i.e. of a key frame's widest possible field.
+        int Bits() const noexcept
+        {
+            T widest = std::max({ m_maxCell.x, m_maxCell.y, m_maxCell.z });
+            return std::bit_width(static_cast<std::uint32_t>(widest));
+        }
+
+        // Positions outside the bounds are clamped to the nearest edge cell.
+        void Quantize(const Vector3SoA<T>& positions, QuantizedVector3SoA& out) const
+        {
+            out.Resize(positions.Size());
+
+            const T* px = positions.x.data();
+            const T* py = positions.y.data();
+            const T* pz = positions.z.data();
+            std::uint32_t* qx = out.x.data();
+            std::uint32_t* qy = out.y.data();
+            std::uint32_t* qz = out.z.data();
+            RigidTransform<T> toLocal = m_toLocal;
+            Vector3<T> min = m_min;
+            Vector3<T> maxCell = m_maxCell;
+            T invPrecision = m_invPrecision;
+
+            Detail::ParallelFor(positions.Size(), [=](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    Vector3<T> cell = (toLocal.TransformPoint({ px[i], py[i], pz[i] }) - min) * invPrecision;
+                    qx[i] = ToCell(cell.x, maxCell.x);
+                    qy[i] = ToCell(cell.y, maxCell.y);
+                    qz[i] = ToCell(cell.z, maxCell.z);
+                }
+            }, positions.Resource());
+        }
+
+        void Dequantize(const QuantizedVector3SoA& quantized, Vector3SoA<T>& out) const
+        {
+            out.Resize(quantized.Size());
+
+            const std::uint32_t* qx = quantized.x.data();
+            const std::uint32_t* qy = quantized.y.data();
+            const std::uint32_t* qz = quantized.z.data();
+            T* px = out.x.data();
+            T* py = out.y.data();
+            T* pz = out.z.data();
+            RigidTransform<T> frame = m_frame;
+            Vector3<T> min = m_min;
+            T precision = m_precision;
+
+            Detail::ParallelFor(quantized.Size(), [=](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    Vector3<T> cell(FromCell(qx[i]), FromCell(qy[i]), FromCell(qz[i]));
+                    Vector3<T> p = frame.TransformPoint(min + cell * precision);
+                    px[i] = p.x;
+                    py[i] = p.y;
+                    pz[i] = p.z;
+                }
+            }, out.Resource());
+        }
+
+        // An empty baseline encodes a key frame.
+        void Encode(const QuantizedVector3SoA& current, const QuantizedVector3SoA& baseline, std::vector<std::uint64_t>& outWords) const
+        {
+            assert(baseline.IsEmpty() || baseline.Size() == current.Size());
+            assert(current.Size() <= std::numeric_limits<std::uint32_t>::max());
+
+            bool delta = !baseline.IsEmpty();
+            std::size_t count = current.Size();
+            outWords.clear();
+            outWords.push_back(static_cast<std::uint64_t>(count) | (delta ? kDeltaFlag : 0));
+
+            const std::uint32_t* currentLanes[3] = { current.x.data(), current.y.data(), current.z.data() };
+            const std::uint32_t* baselineLanes[3] = { baseline.x.data(), baseline.y.data(), baseline.z.data() };
+            std::uint64_t fields[3][kBlockSize];
+
+            Detail::BitWriter writer(outWords);
+            for (std::size_t first = 0; first < count; first += kBlockSize)
+            {
+                std::size_t n = std::min(kBlockSize, count - first);
+                int widths[3];
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    const std::uint32_t* reference = delta ? baselineLanes[axis] + first : nullptr;
+                    widths[axis] = PrepareLane(currentLanes[axis] + first, reference, n, fields[axis]);
+                }
+
+                writer.Write(static_cast<std::uint64_t>(widths[0] | (widths[1] << 6) | (widths[2] << 12)), kHeaderBits);
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    if (widths[axis] > 0)
+                    {
+                        for (std::size_t i = 0; i < n; ++i)
+                        {
+                            writer.Write(fields[axis][i], widths[axis]);
+                        }
+                    }
+                }
+            }
+            writer.Flush();
+            outWords.push_back(0);
+        }
+
+        // Fails on truncated or malformed streams, and when the stream's frame type or size does not match
+        // the baseline given.
+        bool Decode(std::span<const std::uint64_t> words, const QuantizedVector3SoA& baseline, QuantizedVector3SoA& out) const
+        {
+            if (words.size() < 2)
+            {
+                return false;
+            }
+
+            bool delta = (words[0] & kDeltaFlag) != 0;
+            std::uint64_t count = words[0] & ~kDeltaFlag;
+            if (count > std::numeric_limits<std::uint32_t>::max() || delta == baseline.IsEmpty() || (delta && baseline.Size() != count))
+            {
+                return false;
+            }
+
+            // Every block costs at least its header, so a count the stream cannot hold is rejected before it
+            // sizes the output.
+            const std::uint64_t* data = words.data() + 1;
+            std::size_t dataBits = (words.size() - 2) * 64;
+            if ((count + kBlockSize - 1) / kBlockSize > dataBits / kHeaderBits)
+            {
+                return false;
+            }
+            out.Resize(static_cast<std::size_t>(count));
+
+            std::uint32_t* outLanes[3] = { out.x.data(), out.y.data(), out.z.data() };
+            const std::uint32_t* baselineLanes[3] = { baseline.x.data(), baseline.y.data(), baseline.z.data() };
+
+            std::size_t offset = 0;
+            for (std::size_t first = 0; first < out.Size(); first += kBlockSize)
+            {
+                std::size_t n = std::min(kBlockSize, out.Size() - first);
+                if (dataBits - offset < kHeaderBits)
+                {
+                    return false;
+                }
+
+                std::uint64_t header = Detail::ExtractBits(data, offset, kHeaderBits);
+                offset += kHeaderBits;
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    int width = static_cast<int>((header >> (6 * axis)) & 63);
+                    if (width > kMaxFieldBits || (dataBits - offset) / n < static_cast<std::size_t>(width))
+                    {
+                        return false;
+                    }
+
+                    const std::uint32_t* reference = delta ? baselineLanes[axis] + first : nullptr;
+                    DecodeLane(data, offset, width, n, reference, outLanes[axis] + first);
+                    offset += n * static_cast<std::size_t>(width);
+                }
+            }
+            return true;
+        }
+
+    private:
+        static constexpr std::uint64_t kDeltaFlag = std::uint64_t(1) << 63;
+        static constexpr int kHeaderBits = 18;
+
+        // A zigzagged difference of two 32-bit cells.
+        static constexpr int kMaxFieldBits = 33;
+
+        RigidTransform<T> m_frame;
+        RigidTransform<T> m_toLocal;
+        Vector3<T> m_min;
+        Vector3<T> m_maxCell;
+        T m_precision;
+        T m_invPrecision;
+
+        // Cells fit in 31 bits, so the conversion can go through int32, which every SIMD ISA converts natively.
+        // NaN fails the first comparison and maps to cell 0 rather than reaching the conversion.
+        static std::uint32_t ToCell(T value, T maxCell) noexcept
+        {
+            T cell = std::nearbyint(value);
+            cell = (cell >= kZero<T>) ? cell : kZero<T>;
+            cell = (cell > maxCell) ? maxCell : cell;
+            return static_cast<std::uint32_t>(static_cast<std::int32_t>(cell));
+        }
+
+        static T FromCell(std::uint32_t cell) noexcept
+        {
+            return static_cast<T>(static_cast<std::int32_t>(cell));
+        }
+
+        static int PrepareLane(const std::uint32_t* current, const std::uint32_t* baseline, std::size_t n, std::uint64_t* outFields) noexcept
+        {
+            std::uint64_t bits = 0;
+            if (baseline != nullptr)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    outFields[i] = Detail::ZigZag(static_cast<std::int64_t>(current[i]) - static_cast<std::int64_t>(baseline[i]));
+                    bits |= outFields[i];
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    outFields[i] = current[i];
+                    bits |= outFields[i];
+                }
+            }
+            return std::bit_width(bits);
+        }
+
+        static void DecodeLane(const std::uint64_t* data, std::size_t offset, int width, std::size_t n,
+            const std::uint32_t* baseline, std::uint32_t* out) noexcept
+        {
+            // A zero-width lane has no bits to read, and its offset may already sit on the padding word.
+            if (width == 0)
+            {
+                if (baseline != nullptr)
+                {
+                    std::copy_n(baseline, n, out);
+                }
+                else
+                {
+                    std::fill_n(out, n, 0u);
+                }
+                return;
+            }
+
+            if (baseline != nullptr)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    std::int64_t difference = Detail::UnZigZag(Detail::ExtractBits(data, offset + i * width, width));
+                    out[i] = static_cast<std::uint32_t>(static_cast<std::int64_t>(baseline[i]) + difference);
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    out[i] = static_cast<std::uint32_t>(Detail::ExtractBits(data, offset + i * width, width));
+                }
+            }
+        }
+    };
+
+    using FVector3DeltaCodec = Vector3DeltaCodec<float>;
+    using DVector3DeltaCodec = Vector3DeltaCodec<double>;
+    using LDVector3DeltaCodec = Vector3DeltaCodec<long double>;
+}
@@ -0,0 +1,164 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "Constants.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    namespace Detail
+    {
+        template<typename V>
+        inline constexpr bool kIsVector3 = false;
+
+        template<std::floating_point T>
+        inline constexpr bool kIsVector3<Vector3<T>> = true;
+
+        // Marks expression nodes, which are small and held by value. Anything else, i.e. containers, is held
+        // by reference and must outlive the expression.
+        struct ExpressionTag {};
+
+        template<typename E>
+        using ExpressionOperand = std::conditional_t<std::derived_from<E, ExpressionTag>, E, const E&>;
+
+        template<typename E>
+        using ExpressionScalar = decltype(std::declval<const E&>().Get(0).x);
+
+        struct CrossOperation
+        {
+            template<std::floating_point T>
+            constexpr Vector3<T> operator()(const Vector3<T>& a, const Vector3<T>& b) const noexcept
+            {
+                return a.Cross(b);
+            }
+        };
+    }
+
+    // Anything that yields one Vector3 per index: SoA containers and the lazy nodes built from them.
+    template<typename E>
+    concept Vector3Expression = requires(const E& e, std::size_t index)
+    {
+        { e.Size() } -> std::convertible_to<std::size_t>;
+        requires Detail::kIsVector3<decltype(e.Get(index))>;
+    };
+
+    template<typename L, typename R, typename Operation>
+    class BinaryExpression;
+
+    template<typename E>
+    class ScaleExpression;
+
+    // Operators that build lazy nodes instead of computing anything. Nothing runs until the expression is
+    // assigned to a container, which evaluates the whole tree per element in a single loop.
+    template<typename Derived, std::floating_point T>
+    struct Vector3ExpressionOperators
+    {
+        template<Vector3Expression R>
+        auto Cross(const R& other) const noexcept
+        {
+            return BinaryExpression<Derived, R, Detail::CrossOperation>(Self(), other);
+        }
+
+        template<Vector3Expression R>
+        friend auto operator+(const Derived& lhs, const R& rhs) noexcept
+        {
+            return BinaryExpression<Derived, R, std::plus<>>(lhs, rhs);
+        }
+
+        template<Vector3Expression R>
+        friend auto operator-(const Derived& lhs, const R& rhs) noexcept
+        {
+            return BinaryExpression<Derived, R, std::minus<>>(lhs, rhs);
+        }
+
+        template<Vector3Expression R>
+        friend auto operator*(const Derived& lhs, const R& rhs) noexcept
+        {
+            return BinaryExpression<Derived, R, std::multiplies<>>(lhs, rhs);
+        }
+
+        friend auto operator*(const Derived& e, T scalar) noexcept
+        {
+            return ScaleExpression<Derived>(e, scalar);
+        }
+
+        friend auto operator*(T scalar, const Derived& e) noexcept
+        {
+            return ScaleExpression<Derived>(e, scalar);
+        }
+
+        friend auto operator/(const Derived& e, T scalar) noexcept
+        {
+            return ScaleExpression<Derived>(e, kOne<T> / scalar);
+        }
+
+        friend auto operator-(const Derived& e) noexcept
+        {
+            return ScaleExpression<Derived>(e, -kOne<T>);
+        }
+
+    private:
+        const Derived& Self() const noexcept
+        {
+            return static_cast<const Derived&>(*this);
+        }
+    };
+
+    template<typename L, typename R, typename Operation>
+    class BinaryExpression :
+        public Detail::ExpressionTag,
+        public Vector3ExpressionOperators<BinaryExpression<L, R, Operation>, Detail::ExpressionScalar<L>>
+    {
+    public:
+        BinaryExpression(const L& lhs, const R& rhs) noexcept : m_lhs(lhs), m_rhs(rhs)
+        {
+            assert(lhs.Size() == rhs.Size());
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return m_lhs.Size();
+        }
+
+        auto Get(std::size_t index) const noexcept
+        {
+            return Operation{}(m_lhs.Get(index), m_rhs.Get(index));
+        }
+
+    private:
+        Detail::ExpressionOperand<L> m_lhs;
+        Detail::ExpressionOperand<R> m_rhs;
+    };
+
+    template<typename E>
+    class ScaleExpression :
+        public Detail::ExpressionTag,
+        public Vector3ExpressionOperators<ScaleExpression<E>, Detail::ExpressionScalar<E>>
+    {
+        using T = Detail::ExpressionScalar<E>;
+
+    public:
+        ScaleExpression(const E& operand, T scalar) noexcept : m_operand(operand), m_scalar(scalar) {}
+
+        std::size_t Size() const noexcept
+        {
+            return m_operand.Size();
+        }
+
+        auto Get(std::size_t index) const noexcept
+        {
+            return m_operand.Get(index) * m_scalar;
+        }
+
+    private:
+        Detail::ExpressionOperand<E> m_operand;
+        T m_scalar;
+    };
+}
@@ -0,0 +1,505 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace Vec23
+{
+    namespace Detail
+    {
+        // Integer-only helpers, so fixed-point results are bit-identical on every compiler and platform.
+
+        struct UInt128
+        {
+            std::uint64_t hi;
+            std::uint64_t lo;
+        };
+
+        constexpr UInt128 MulWide(std::uint64_t a, std::uint64_t b) noexcept
+        {
+            constexpr std::uint64_t kLow = 0xFFFFFFFFu;
+            std::uint64_t ll = (a & kLow) * (b & kLow);
+            std::uint64_t lh = (a & kLow) * (b >> 32);
+            std::uint64_t hl = (a >> 32) * (b & kLow);
+            std::uint64_t hh = (a >> 32) * (b >> 32);
+            std::uint64_t mid = (ll >> 32) + (lh & kLow) + (hl & kLow);
+            return { hh + (lh >> 32) + (hl >> 32) + (mid >> 32), (mid << 32) | (ll & kLow) };
+        }
+
+        constexpr std::uint64_t Magnitude(std::int64_t value) noexcept
+        {
+            return (value < 0) ? std::uint64_t(0) - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        }
+
+        constexpr std::int64_t ApplySign(std::uint64_t magnitude, bool negative) noexcept
+        {
+            return static_cast<std::int64_t>(negative ? std::uint64_t(0) - magnitude : magnitude);
+        }
+
+        // value >> shift, rounded to nearest with ties away from zero.
+        constexpr std::int64_t RoundShift(std::int64_t value, int shift) noexcept
+        {
+            std::uint64_t magnitude = Magnitude(value);
+            return ApplySign((magnitude + (std::uint64_t(1) << (shift - 1))) >> shift, value < 0);
+        }
+
+        // (a * b) >> shift with a 128-bit intermediate, rounded like RoundShift.
+        constexpr std::int64_t MulShift(std::int64_t a, std::int64_t b, int shift) noexcept
+        {
+            UInt128 product = MulWide(Magnitude(a), Magnitude(b));
+            std::uint64_t lo = product.lo + (std::uint64_t(1) << (shift - 1));
+            std::uint64_t hi = product.hi + (lo < product.lo ? 1 : 0);
+            return ApplySign((hi << (64 - shift)) | (lo >> shift), (a < 0) != (b < 0));
+        }
+
+        // (a << shift) / b with a 128-bit intermediate, truncated toward zero. Division by zero saturates.
+        constexpr std::int64_t DivShift(std::int64_t a, std::int64_t b, int shift) noexcept
+        {
+            bool negative = (a < 0) != (b < 0);
+            if (b == 0)
+            {
+                return (a == 0) ? 0 : negative ? std::numeric_limits<std::int64_t>::min() : std::numeric_limits<std::int64_t>::max();
+            }
+
+            std::uint64_t numerator = Magnitude(a);
+            std::uint64_t divisor = Magnitude(b);
+#if defined(__SIZEOF_INT128__)
+            __extension__ using Wide = unsigned __int128;
+            return ApplySign(static_cast<std::uint64_t>((static_cast<Wide>(numerator) << shift) / divisor), negative);
+#else
+            std::uint64_t hi = (shift == 0) ? 0 : numerator >> (64 - shift);
+            std::uint64_t lo = numerator << shift;
+            std::uint64_t quotient = 0;
+            std::uint64_t remainder = 0;
+            for (int bit = 63 + shift; bit >= 0; --bit)
+            {
+                std::uint64_t next = (bit >= 64) ? (hi >> (bit - 64)) & 1 : (lo >> bit) & 1;
+                remainder = (remainder << 1) | next;
+                quotient <<= 1;
+                if (remainder >= divisor)
+                {
+                    remainder -= divisor;
+                    quotient |= 1;
+                }
+            }
+            return ApplySign(quotient, negative);
+#endif
+        }
+
+        constexpr std::uint64_t ISqrt(std::uint64_t value) noexcept
+        {
+            std::uint64_t result = 0;
+            std::uint64_t bit = std::uint64_t(1) << 62;
+            while (bit > value)
+            {
+                bit >>= 2;
+            }
+
+            while (bit != 0)
+            {
+                if (value >= result + bit)
+                {
+                    value -= result + bit;
+                    result = (result >> 1) + bit;
+                }
+                else
+                {
+                    result >>= 1;
+                }
+                bit >>= 2;
+            }
+            return result;
+        }
+
+        inline constexpr int kTrigSegments = 1024;
+        inline constexpr int kTrigTableBits = 32;
+        inline constexpr int kSeriesBits = 60;
+        inline constexpr std::int64_t kSeriesOne = std::int64_t(1) << kSeriesBits;
+        inline constexpr std::int64_t kSeriesPi = 3622009729038561421;
+
+        // Quarter-wave sine and [0, 1] arctangent (in degrees), sampled at kTrigSegments + 1 points in Q32.
+        struct TrigTables
+        {
+            std::int64_t sine[kTrigSegments + 1];
+            std::int64_t atan[kTrigSegments + 1];
+        };
+
+        constexpr std::int64_t SinSeries(std::int64_t x) noexcept
+        {
+            std::int64_t x2 = MulShift(x, x, kSeriesBits);
+            std::int64_t term = x;
+            std::int64_t sum = x;
+            for (int k = 1; term != 0; ++k)
+            {
+                term = -MulShift(term, x2, kSeriesBits) / ((2 * k) * (2 * k + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr std::int64_t AtanSeries(std::int64_t x) noexcept
+        {
+            std::int64_t x2 = MulShift(x, x, kSeriesBits);
+            std::int64_t power = x;
+            std::int64_t sum = x;
+            for (int k = 1; power != 0; ++k)
+            {
+                power = -MulShift(power, x2, kSeriesBits);
+                sum += power / (2 * k + 1);
+            }
+            return sum;
+        }
+
+        constexpr std::int64_t AtanRadians(std::int64_t x) noexcept
+        {
+            // atan(x) = pi/4 + atan((x - 1) / (x + 1)) keeps the series argument below 0.43.
+            if (x > kSeriesOne / 5 * 2)
+            {
+                return kSeriesPi / 4 + AtanSeries(DivShift(x - kSeriesOne, x + kSeriesOne, kSeriesBits));
+            }
+            return AtanSeries(x);
+        }
+
+        inline const TrigTables& GetTrigTables() noexcept
+        {
+            static const TrigTables tables = []
+            {
+                TrigTables result = {};
+                constexpr std::int64_t kDivisions = 2 * kTrigSegments;
+                for (std::int64_t i = 0; i <= kTrigSegments; ++i)
+                {
+                    std::int64_t radians = (kSeriesPi / kDivisions) * i + (kSeriesPi % kDivisions) * i / kDivisions;
+                    result.sine[i] = RoundShift(SinSeries(radians), kSeriesBits - kTrigTableBits);
+
+                    std::int64_t halfTurns = DivShift(AtanRadians(kSeriesOne / kTrigSegments * i), kSeriesPi, kSeriesBits);
+                    result.atan[i] = MulShift(halfTurns, 180, kSeriesBits - kTrigTableBits);
+                }
+                return result;
+            }();
+            return tables;
+        }
+    }
+
+    // Signed fixed-point number with FractionBits fractional bits. Arithmetic wraps on overflow, conversion
+    // from floating point saturates, and both round deterministically; trigonometry uses integer lookup
+    // tables and works in degrees.
+    template<std::signed_integral Raw, int FractionBits>
+    struct Fixed
+    {
+        static_assert(sizeof(Raw) == 4 || sizeof(Raw) == 8);
+        static_assert(FractionBits > 0 && FractionBits <= Detail::kTrigTableBits && FractionBits % 2 == 0);
+        static_assert(FractionBits < static_cast<int>(sizeof(Raw) * 8) - 8);
+
+        using RawType = Raw;
+        static constexpr int kFractionBits = FractionBits;
+
+        Raw raw;
+
+        constexpr Fixed() noexcept : raw(0) {}
+
+        constexpr Fixed(int value) noexcept : raw(static_cast<Raw>(static_cast<Raw>(value) << FractionBits)) {}
+
+        // Values outside the representable range saturate and NaN becomes zero, so float input from gameplay
+        // code never reaches an undefined conversion.
+        template<std::floating_point T>
+        explicit constexpr Fixed(T value) noexcept : raw(RawFromFloat(value)) {}
+
+        static constexpr Fixed FromRaw(Raw value) noexcept
+        {
+            Fixed result;
+            result.raw = value;
+            return result;
+        }
+
+        static constexpr Fixed Epsilon() noexcept
+        {
+            return FromRaw(1);
+        }
+
+        static constexpr Fixed Tolerance() noexcept
+        {
+            return FromRaw(Raw(1) << (FractionBits / 2));
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        template<std::floating_point T>
+        constexpr T ToFloat() const noexcept
+        {
+            return static_cast<T>(raw) / static_cast<T>(kOneRaw);
+        }
+
+        template<std::floating_point T>
+        explicit constexpr operator T() const noexcept
+        {
+            return ToFloat<T>();
+        }
+
+        std::string ToString() const
+        {
+            return std::format("{}", *this);
+        }
+
+        // -------------------------
+        // Utilities
+        // -------------------------
+
+        static constexpr Fixed Abs(Fixed value) noexcept
+        {
+            return (value.raw < 0) ? -value : value;
+        }
+
+        static Fixed Sqrt(Fixed value) noexcept
+        {
+            if (value.raw <= 0)
+            {
+                return {};
+            }
+
+            // Newton from above converges to the floor of the exact root.
+            std::int64_t guess = static_cast<std::int64_t>(Detail::ISqrt(static_cast<std::uint64_t>(value.raw)) + 1) << (FractionBits / 2);
+            while (true)
+            {
+                std::int64_t next = (guess + DivRaw(value.raw, guess)) / 2;
+                if (next >= guess)
+                {
+                    break;
+                }
+                guess = next;
+            }
+            return FromRaw(static_cast<Raw>(guess));
+        }
+
+        static Fixed Sin(Fixed degrees) noexcept
+        {
+            std::int64_t angle = WrapDegrees(degrees.raw);
+
+            std::int64_t position = angle * (4 * Detail::kTrigSegments) / 360;
+            std::int64_t segment = position >> FractionBits;
+            std::int64_t fraction = position & (kOneRaw - 1);
+            std::int64_t quadrant = segment / Detail::kTrigSegments;
+            std::int64_t index = segment % Detail::kTrigSegments;
+
+            const std::int64_t* sine = Detail::GetTrigTables().sine;
+            std::int64_t value = (quadrant % 2 == 0) ?
+                Interpolate(sine[index], sine[index + 1], fraction) :
+                Interpolate(sine[Detail::kTrigSegments - index], sine[Detail::kTrigSegments - index - 1], fraction);
+            return FromTable(quadrant >= 2 ? -value : value);
+        }
+
+        // Reduced to one turn before the quarter-turn shift, which would otherwise wrap near the top of the range.
+        static Fixed Cos(Fixed degrees) noexcept
+        {
+            return Sin(FromRaw(static_cast<Raw>(WrapDegrees(degrees.raw))) + Fixed(90));
+        }
+
+        static Fixed Atan2(Fixed y, Fixed x) noexcept
+        {
+            std::int64_t ax = static_cast<std::int64_t>(Detail::Magnitude(x.raw));
+            std::int64_t ay = static_cast<std::int64_t>(Detail::Magnitude(y.raw));
+            if (ax == 0 && ay == 0)
+            {
+                return {};
+            }
+
+            bool steep = ay > ax;
+            std::int64_t ratio = steep ? DivRaw(ax, ay) : DivRaw(ay, ax);
+            std::int64_t position = ratio * Detail::kTrigSegments;
+            std::int64_t index = position >> FractionBits;
+
+            const std::int64_t* atan = Detail::GetTrigTables().atan;
+            std::int64_t degrees = (index >= Detail::kTrigSegments) ?
+                atan[Detail::kTrigSegments] :
+                Interpolate(atan[index], atan[index + 1], position & (kOneRaw - 1));
+
+            constexpr std::int64_t kQuarterTurn = std::int64_t(90) << Detail::kTrigTableBits;
+            if (steep)
+            {
+                degrees = kQuarterTurn - degrees;
+            }
+            if (x.raw < 0)
+            {
+                degrees = 2 * kQuarterTurn - degrees;
+            }
+            return FromTable(y.raw < 0 ? -degrees : degrees);
+        }
+
+        static Fixed Asin(Fixed value) noexcept
+        {
+            value = Clamp(value, Fixed(-1), Fixed(1));
+            return Atan2(value, Sqrt(Fixed(1) - value * value));
+        }
+
+        static Fixed Acos(Fixed value) noexcept
+        {
+            value = Clamp(value, Fixed(-1), Fixed(1));
+            return Atan2(Sqrt(Fixed(1) - value * value), value);
+        }
+
+        static constexpr Fixed Clamp(Fixed value, Fixed low, Fixed high) noexcept
+        {
+            return (value < low) ? low : (high < value) ? high : value;
+        }
+
+        static constexpr Fixed Lerp(Fixed a, Fixed b, Fixed t) noexcept
+        {
+            return a + (b - a) * t;
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr auto operator<=>(const Fixed& other) const noexcept = default;
+
+        constexpr Fixed operator-() const noexcept
+        {
+            return FromRaw(static_cast<Raw>(Unsigned(0) - static_cast<Unsigned>(raw)));
+        }
+
+        constexpr Fixed& operator+=(Fixed other) noexcept
+        {
+            return *this = *this + other;
+        }
+
+        constexpr Fixed& operator-=(Fixed other) noexcept
+        {
+            return *this = *this - other;
+        }
+
+        constexpr Fixed& operator*=(Fixed other) noexcept
+        {
+            return *this = *this * other;
+        }
+
+        constexpr Fixed& operator/=(Fixed other) noexcept
+        {
+            return *this = *this / other;
+        }
+
+        constexpr friend Fixed operator+(Fixed a, Fixed b) noexcept
+        {
+            return FromRaw(static_cast<Raw>(static_cast<Unsigned>(a.raw) + static_cast<Unsigned>(b.raw)));
+        }
+
+        constexpr friend Fixed operator-(Fixed a, Fixed b) noexcept
+        {
+            return FromRaw(static_cast<Raw>(static_cast<Unsigned>(a.raw) - static_cast<Unsigned>(b.raw)));
+        }
+
+        constexpr friend Fixed operator*(Fixed a, Fixed b) noexcept
+        {
+            if constexpr (sizeof(Raw) == 4)
+            {
+                return FromRaw(static_cast<Raw>(Detail::RoundShift(std::int64_t(a.raw) * b.raw, FractionBits)));
+            }
+            else
+            {
+                return FromRaw(static_cast<Raw>(Detail::MulShift(a.raw, b.raw, FractionBits)));
+            }
+        }
+
+        constexpr friend Fixed operator/(Fixed a, Fixed b) noexcept
+        {
+            std::int64_t quotient = DivRaw(a.raw, b.raw);
+            if constexpr (sizeof(Raw) == 4)
+            {
+                quotient = std::clamp<std::int64_t>(quotient, std::numeric_limits<Raw>::min(), std::numeric_limits<Raw>::max());
+            }
+            return FromRaw(static_cast<Raw>(quotient));
+        }
+
+    private:
+        using Unsigned = std::make_unsigned_t<Raw>;
+
+        static constexpr std::int64_t kOneRaw = std::int64_t(1) << FractionBits;
+
+        template<std::floating_point T>
+        static constexpr Raw RawFromFloat(T value) noexcept
+        {
+            // -min is a power of two, so it is exact in every floating-point type.
+            constexpr T kLimit = -static_cast<T>(std::numeric_limits<Raw>::min());
+            T scaled = value * static_cast<T>(kOneRaw) + (value < T(0) ? T(-0.5) : T(0.5));
+            if (scaled != scaled)
+            {
+                return 0;
+            }
+            if (scaled >= kLimit)
+            {
+                return std::numeric_limits<Raw>::max();
+            }
+            if (scaled <= -kLimit)
+            {
+                return std::numeric_limits<Raw>::min();
+            }
+            return static_cast<Raw>(scaled);
+        }
+
+        // Angle in [0, 360) degrees, as a raw value.
+        static constexpr std::int64_t WrapDegrees(Raw degrees) noexcept
+        {
+            constexpr std::int64_t kFullTurn = std::int64_t(360) << FractionBits;
+            std::int64_t angle = static_cast<std::int64_t>(degrees) % kFullTurn;
+            return (angle < 0) ? angle + kFullTurn : angle;
+        }
+
+        static constexpr std::int64_t DivRaw(std::int64_t a, std::int64_t b) noexcept
+        {
+            if constexpr (sizeof(Raw) == 4)
+            {
+                if (b == 0)
+                {
+                    return (a == 0) ? 0 : (a < 0) ? std::numeric_limits<std::int64_t>::min() : std::numeric_limits<std::int64_t>::max();
+                }
+                return (a * kOneRaw) / b;
+            }
+            else
+            {
+                return Detail::DivShift(a, b, FractionBits);
+            }
+        }
+
+        static constexpr std::int64_t Interpolate(std::int64_t a, std::int64_t b, std::int64_t fraction) noexcept
+        {
+            return a + Detail::MulShift(b - a, fraction, FractionBits);
+        }
+
+        static constexpr Fixed FromTable(std::int64_t value) noexcept
+        {
+            if constexpr (FractionBits == Detail::kTrigTableBits)
+            {
+                return FromRaw(static_cast<Raw>(value));
+            }
+            else
+            {
+                return FromRaw(static_cast<Raw>(Detail::RoundShift(value, Detail::kTrigTableBits - FractionBits)));
+            }
+        }
+    };
+
+    template<typename Q>
+    concept FixedPoint = std::same_as<Q, Fixed<typename Q::RawType, Q::kFractionBits>>;
+
+    using Q16_16 = Fixed<std::int32_t, 16>;
+    using Q32_32 = Fixed<std::int64_t, 32>;
+}
+
+template<std::signed_integral Raw, int FractionBits>
+struct std::formatter<Vec23::Fixed<Raw, FractionBits>> : std::formatter<double>
+{
+    template<typename FormatContext>
+    auto format(const Vec23::Fixed<Raw, FractionBits>& value, FormatContext& ctx) const
+    {
+        return std::formatter<double>::format(value.template ToFloat<double>(), ctx);
+    }
+};
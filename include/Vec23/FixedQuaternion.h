@@ -0,0 +1,383 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <format>
+#include <string>
+#include "Fixed.h"
+#include "FixedVector3.h"
+
+namespace Vec23
+{
+    template<FixedPoint Q>
+    struct FixedQuaternion
+    {
+        Q w;
+        Q x;
+        Q y;
+        Q z;
+
+        constexpr FixedQuaternion() noexcept : w(1), x(), y(), z() {}
+
+        constexpr FixedQuaternion(Q w, Q x, Q y, Q z) noexcept : w(w), x(x), y(y), z(z) {}
+
+        static constexpr FixedQuaternion Identity() noexcept
+        {
+            return FixedQuaternion();
+        }
+
+        static FixedQuaternion FromAxisAngle(const FixedVector3<Q>& axis, Q degrees) noexcept
+        {
+            Q halfDegrees = degrees / Q(2);
+            Q cosT = Q::Cos(halfDegrees);
+            Q sinT = Q::Sin(halfDegrees);
+
+            FixedVector3<Q> u = axis;
+            if (u.LengthSquared() <= Q())
+            {
+                return Identity();
+            }
+
+            if (!u.IsNormalized())
+            {
+                u.Normalize();
+            }
+
+            return { cosT, u.x * sinT, u.y * sinT, u.z * sinT };
+        }
+
+        static FixedQuaternion FromEuler(Q rollDegrees, Q pitchDegrees, Q yawDegrees) noexcept
+        {
+            Q cosRoll = Q::Cos(rollDegrees / Q(2));
+            Q sinRoll = Q::Sin(rollDegrees / Q(2));
+            Q cosPitch = Q::Cos(pitchDegrees / Q(2));
+            Q sinPitch = Q::Sin(pitchDegrees / Q(2));
+            Q cosYaw = Q::Cos(yawDegrees / Q(2));
+            Q sinYaw = Q::Sin(yawDegrees / Q(2));
+
+            return FixedQuaternion(
+                cosRoll * cosPitch * cosYaw + sinRoll * sinPitch * sinYaw,
+                sinRoll * cosPitch * cosYaw - cosRoll * sinPitch * sinYaw,
+                cosRoll * sinPitch * cosYaw + sinRoll * cosPitch * sinYaw,
+                cosRoll * cosPitch * sinYaw - sinRoll * sinPitch * cosYaw
+            );
+        }
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        void Normalize() noexcept
+        {
+            Q length = Length();
+            if (length > Q())
+            {
+                w /= length;
+                x /= length;
+                y /= length;
+                z /= length;
+            }
+            else
+            {
+                *this = Identity();
+            }
+        }
+
+        constexpr void Conjugate() noexcept
+        {
+            x = -x;
+            y = -y;
+            z = -z;
+        }
+
+        constexpr void Inverse() noexcept
+        {
+            Q lengthSq = LengthSquared();
+            if (lengthSq > Q())
+            {
+                w = w / lengthSq;
+                x = -x / lengthSq;
+                y = -y / lengthSq;
+                z = -z / lengthSq;
+            }
+            else
+            {
+                *this = Identity();
+            }
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr bool IsNormalized() const noexcept
+        {
+            return Q::Abs(LengthSquared() - Q(1)) < Q::Tolerance();
+        }
+
+        Q Length() const noexcept
+        {
+            return Q::Sqrt(LengthSquared());
+        }
+
+        constexpr Q LengthSquared() const noexcept
+        {
+            return (w * w) + (x * x) + (y * y) + (z * z);
+        }
+
+        constexpr Q Dot(const FixedQuaternion& other) const noexcept
+        {
+            return (w * other.w) + (x * other.x) + (y * other.y) + (z * other.z);
+        }
+
+        FixedQuaternion GetNormalized() const noexcept
+        {
+            FixedQuaternion result = *this;
+            result.Normalize();
+            return result;
+        }
+
+        constexpr FixedQuaternion GetConjugated() const noexcept
+        {
+            FixedQuaternion result = *this;
+            result.Conjugate();
+            return result;
+        }
+
+        constexpr FixedQuaternion GetInversed() const noexcept
+        {
+            FixedQuaternion result = *this;
+            result.Inverse();
+            return result;
+        }
+
+        constexpr FixedVector3<Q> RotateVector(const FixedVector3<Q>& v) const noexcept
+        {
+            Q tempX = Q(2) * (y * v.z - z * v.y);
+            Q tempY = Q(2) * (z * v.x - x * v.z);
+            Q tempZ = Q(2) * (x * v.y - y * v.x);
+
+            return FixedVector3<Q>(
+                v.x + w * tempX + (y * tempZ - z * tempY),
+                v.y + w * tempY + (z * tempX - x * tempZ),
+                v.z + w * tempZ + (x * tempY - y * tempX)
+            );
+        }
+
+        FixedVector3<Q> ToEuler() const noexcept
+        {
+            FixedVector3<Q> euler;
+
+            Q gimbalTest = w * y - x * z;
+            Q half = Q(1) / Q(2);
+            if (gimbalTest > half - Q::Tolerance())
+            {
+                euler.x = Q();
+                euler.y = Q(90);
+                euler.z = Q(2) * Q::Atan2(z, w);
+            }
+            else if (gimbalTest < Q::Tolerance() - half)
+            {
+                euler.x = Q();
+                euler.y = Q(-90);
+                euler.z = Q(2) * Q::Atan2(x, w);
+            }
+            else
+            {
+                Q wSq = w * w;
+                Q xSq = x * x;
+                Q ySq = y * y;
+                Q zSq = z * z;
+
+                euler.x = Q::Atan2(Q(2) * (w * x + y * z), wSq - xSq - ySq + zSq);
+                euler.y = Q::Asin(Q(-2) * (x * z - w * y));
+                euler.z = Q::Atan2(Q(2) * (x * y + w * z), wSq + xSq - ySq - zSq);
+            }
+
+            return euler;
+        }
+
+        void ToAxisAngle(FixedVector3<Q>& outAxis, Q& outDegrees) const noexcept
+        {
+            Q clampedW = Q::Clamp(w, Q(-1), Q(1));
+            Q sinSqT = Q(1) - (clampedW * clampedW);
+            if (sinSqT <= Q())
+            {
+                outAxis = { Q(1), Q(), Q() };
+                outDegrees = Q();
+            }
+            else
+            {
+                Q sinT = Q::Sqrt(sinSqT);
+                outAxis.x = x / sinT;
+                outAxis.y = y / sinT;
+                outAxis.z = z / sinT;
+                outDegrees = Q::Acos(clampedW) * Q(2);
+            }
+        }
+
+        constexpr bool IsNearlyEqual(const FixedQuaternion& other, Q epsilon = Q::Tolerance()) const noexcept
+        {
+            Q lenSqA = LengthSquared();
+            Q lenSqB = other.LengthSquared();
+            if (lenSqA <= Q() || lenSqB <= Q())
+            {
+                return lenSqA <= Q() && lenSqB <= Q();
+            }
+
+            Q dot = Dot(other);
+            return Q::Abs(dot * dot - lenSqA * lenSqB) <= epsilon;
+        }
+
+        std::string ToString() const
+        {
+            return std::format("{}", *this);
+        }
+
+        // -------------------------
+        // Utilities
+        // -------------------------
+
+        static FixedQuaternion Lerp(const FixedQuaternion& a, const FixedQuaternion& b, Q t) noexcept
+        {
+            t = Q::Clamp(t, Q(), Q(1));
+            const FixedQuaternion target = (a.Dot(b) < Q()) ? -b : b;
+
+            FixedQuaternion result(
+                Q::Lerp(a.w, target.w, t),
+                Q::Lerp(a.x, target.x, t),
+                Q::Lerp(a.y, target.y, t),
+                Q::Lerp(a.z, target.z, t)
+            );
+
+            result.Normalize();
+            return result;
+        }
+
+        static FixedQuaternion Slerp(const FixedQuaternion& a, const FixedQuaternion& b, Q t) noexcept
+        {
+            t = Q::Clamp(t, Q(), Q(1));
+
+            Q dot = a.Dot(b);
+            FixedQuaternion target = b;
+            if (dot < Q())
+            {
+                dot = -dot;
+                target = -b;
+            }
+
+            if (dot > Q(1) - Q::Tolerance())
+            {
+                return Lerp(a, target, t);
+            }
+
+            Q theta = Q::Acos(dot);
+            Q sinT = Q::Sin(theta);
+            Q scaleA = Q::Sin((Q(1) - t) * theta) / sinT;
+            Q scaleB = Q::Sin(t * theta) / sinT;
+            return (scaleA * a) + (scaleB * target);
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const FixedQuaternion& other) const noexcept = default;
+
+        constexpr FixedQuaternion operator+(const FixedQuaternion& other) const noexcept
+        {
+            return { w + other.w, x + other.x, y + other.y, z + other.z };
+        }
+
+        constexpr FixedQuaternion operator-(const FixedQuaternion& other) const noexcept
+        {
+            return { w - other.w, x - other.x, y - other.y, z - other.z };
+        }
+
+        constexpr FixedQuaternion operator*(const FixedQuaternion& other) const noexcept
+        {
+            return FixedQuaternion(
+                w * other.w - x * other.x - y * other.y - z * other.z,
+                w * other.x + x * other.w + y * other.z - z * other.y,
+                w * other.y - x * other.z + y * other.w + z * other.x,
+                w * other.z + x * other.y - y * other.x + z * other.w
+            );
+        }
+
+        constexpr FixedQuaternion operator*(Q scalar) const noexcept
+        {
+            return { w * scalar, x * scalar, y * scalar, z * scalar };
+        }
+
+        constexpr FixedVector3<Q> operator*(const FixedVector3<Q>& v) const noexcept
+        {
+            return RotateVector(v);
+        }
+
+        constexpr FixedQuaternion operator/(Q scalar) const noexcept
+        {
+            return { w / scalar, x / scalar, y / scalar, z / scalar };
+        }
+
+        constexpr FixedQuaternion operator-() const noexcept
+        {
+            return { -w, -x, -y, -z };
+        }
+
+        constexpr FixedQuaternion& operator*=(const FixedQuaternion& other) noexcept
+        {
+            *this = *this * other;
+            return *this;
+        }
+
+        constexpr FixedQuaternion& operator*=(Q scalar) noexcept
+        {
+            w *= scalar;
+            x *= scalar;
+            y *= scalar;
+            z *= scalar;
+            return *this;
+        }
+
+        constexpr FixedQuaternion& operator/=(Q scalar) noexcept
+        {
+            *this = *this / scalar;
+            return *this;
+        }
+
+        constexpr friend FixedQuaternion operator*(Q scalar, const FixedQuaternion& q) noexcept
+        {
+            return q * scalar;
+        }
+    };
+
+    using Q16Quaternion = FixedQuaternion<Q16_16>;
+    using Q32Quaternion = FixedQuaternion<Q32_32>;
+}
+
+template<Vec23::FixedPoint Q>
+struct std::formatter<Vec23::FixedQuaternion<Q>> : std::formatter<Q>
+{
+    template<typename FormatContext>
+    auto format(const Vec23::FixedQuaternion<Q>& q, FormatContext& ctx) const
+    {
+        auto out = ctx.out();
+        *out++ = '(';
+        ctx.advance_to(out);
+        out = std::formatter<Q>::format(q.w, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<Q>::format(q.x, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<Q>::format(q.y, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<Q>::format(q.z, ctx);
+        *out++ = ')';
+        return out;
+    }
+};
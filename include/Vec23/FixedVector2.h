@@ -0,0 +1,240 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <cassert>
+#include <format>
+#include <string>
+#include "Fixed.h"
+
+namespace Vec23
+{
+    template<FixedPoint Q>
+    struct FixedVector2
+    {
+        Q x;
+        Q y;
+
+        constexpr FixedVector2() noexcept : x(), y() {}
+
+        constexpr FixedVector2(Q x, Q y) noexcept : x(x), y(y) {}
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        void Normalize() noexcept
+        {
+            Q length = Length();
+            if (length > Q())
+            {
+                x /= length;
+                y /= length;
+            }
+            else
+            {
+                x = y = Q();
+            }
+        }
+
+        void Rotate(Q degrees) noexcept
+        {
+            Q cosT = Q::Cos(degrees);
+            Q sinT = Q::Sin(degrees);
+
+            Q oldX = x;
+            x = (oldX * cosT) - (y * sinT);
+            y = (oldX * sinT) + (y * cosT);
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr bool IsNormalized() const noexcept
+        {
+            return Q::Abs(LengthSquared() - Q(1)) < Q::Tolerance();
+        }
+
+        FixedVector2 GetNormalized() const noexcept
+        {
+            FixedVector2 result = *this;
+            result.Normalize();
+            return result;
+        }
+
+        FixedVector2 GetRotated(Q degrees) const noexcept
+        {
+            FixedVector2 result = *this;
+            result.Rotate(degrees);
+            return result;
+        }
+
+        Q Length() const noexcept
+        {
+            return Q::Sqrt(LengthSquared());
+        }
+
+        constexpr Q LengthSquared() const noexcept
+        {
+            return (x * x) + (y * y);
+        }
+
+        constexpr Q Dot(const FixedVector2& other) const noexcept
+        {
+            return (x * other.x) + (y * other.y);
+        }
+
+        constexpr Q Cross(const FixedVector2& other) const noexcept
+        {
+            return (x * other.y) - (y * other.x);
+        }
+
+        constexpr bool IsNearlyEqual(const FixedVector2& other, Q epsilon = Q::Tolerance()) const noexcept
+        {
+            return DistanceSquared(*this, other) < (epsilon * epsilon);
+        }
+
+        std::string ToString() const
+        {
+            return std::format("{}", *this);
+        }
+
+        // -------------------------
+        // Utilities
+        // -------------------------
+
+        static Q Distance(const FixedVector2& a, const FixedVector2& b) noexcept
+        {
+            return (b - a).Length();
+        }
+
+        static constexpr Q DistanceSquared(const FixedVector2& a, const FixedVector2& b) noexcept
+        {
+            return (b - a).LengthSquared();
+        }
+
+        static constexpr FixedVector2 Reflect(const FixedVector2& v, const FixedVector2& n) noexcept
+        {
+            return v - n * (Q(2) * v.Dot(n));
+        }
+
+        static constexpr FixedVector2 Lerp(const FixedVector2& a, const FixedVector2& b, Q t) noexcept
+        {
+            return { Q::Lerp(a.x, b.x, t), Q::Lerp(a.y, b.y, t) };
+        }
+
+        static Q Angle(const FixedVector2& a, const FixedVector2& b) noexcept
+        {
+            return Q::Abs(SignedAngle(a, b));
+        }
+
+        static Q SignedAngle(const FixedVector2& a, const FixedVector2& b) noexcept
+        {
+            return Q::Atan2(a.Cross(b), a.Dot(b));
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const FixedVector2& other) const noexcept = default;
+
+        constexpr FixedVector2 operator+(const FixedVector2& other) const noexcept
+        {
+            return { x + other.x, y + other.y };
+        }
+
+        constexpr FixedVector2 operator-(const FixedVector2& other) const noexcept
+        {
+            return { x - other.x, y - other.y };
+        }
+
+        constexpr FixedVector2 operator*(const FixedVector2& other) const noexcept
+        {
+            return { x * other.x, y * other.y };
+        }
+
+        constexpr FixedVector2 operator*(Q scalar) const noexcept
+        {
+            return { x * scalar, y * scalar };
+        }
+
+        constexpr FixedVector2 operator/(Q scalar) const noexcept
+        {
+            return { x / scalar, y / scalar };
+        }
+
+        constexpr FixedVector2 operator-() const noexcept
+        {
+            return { -x, -y };
+        }
+
+        constexpr FixedVector2& operator+=(const FixedVector2& other) noexcept
+        {
+            x += other.x;
+            y += other.y;
+            return *this;
+        }
+
+        constexpr FixedVector2& operator-=(const FixedVector2& other) noexcept
+        {
+            x -= other.x;
+            y -= other.y;
+            return *this;
+        }
+
+        constexpr FixedVector2& operator*=(Q scalar) noexcept
+        {
+            x *= scalar;
+            y *= scalar;
+            return *this;
+        }
+
+        constexpr FixedVector2& operator/=(Q scalar) noexcept
+        {
+            x /= scalar;
+            y /= scalar;
+            return *this;
+        }
+
+        constexpr Q& operator[](int index) noexcept
+        {
+            assert(index >= 0 && index < 2);
+            return (&x)[index];
+        }
+
+        constexpr const Q& operator[](int index) const noexcept
+        {
+            assert(index >= 0 && index < 2);
+            return (&x)[index];
+        }
+
+        constexpr friend FixedVector2 operator*(Q scalar, const FixedVector2& v) noexcept
+        {
+            return v * scalar;
+        }
+    };
+
+    using Q16Vector2 = FixedVector2<Q16_16>;
+    using Q32Vector2 = FixedVector2<Q32_32>;
+}
+
+template<Vec23::FixedPoint Q>
+struct std::formatter<Vec23::FixedVector2<Q>> : std::formatter<Q>
+{
+    template<typename FormatContext>
+    auto format(const Vec23::FixedVector2<Q>& v, FormatContext& ctx) const
+    {
+        auto out = ctx.out();
+        *out++ = '(';
+        ctx.advance_to(out);
+        out = std::formatter<Q>::format(v.x, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<Q>::format(v.y, ctx);
+        *out++ = ')';
+        return out;
+    }
+};
@@ -0,0 +1,262 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <cassert>
+#include <format>
+#include <string>
+#include "Fixed.h"
+
+namespace Vec23
+{
+    template<FixedPoint Q>
+    struct FixedVector3
+    {
+        Q x;
+        Q y;
+        Q z;
+
+        constexpr FixedVector3() noexcept : x(), y(), z() {}
+
+        constexpr FixedVector3(Q x, Q y, Q z) noexcept : x(x), y(y), z(z) {}
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        void Normalize() noexcept
+        {
+            Q length = Length();
+            if (length > Q())
+            {
+                x /= length;
+                y /= length;
+                z /= length;
+            }
+            else
+            {
+                x = y = z = Q();
+            }
+        }
+
+        void Rotate(Q degrees, const FixedVector3& axis) noexcept
+        {
+            Q cosT = Q::Cos(degrees);
+            Q sinT = Q::Sin(degrees);
+
+            FixedVector3 u = axis;
+            if (!u.IsNormalized())
+            {
+                u.Normalize();
+            }
+
+            FixedVector3 v = *this;
+            *this = (v * cosT) + (u.Cross(v) * sinT) + (u * (u.Dot(v) * (Q(1) - cosT)));
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr bool IsNormalized() const noexcept
+        {
+            return Q::Abs(LengthSquared() - Q(1)) < Q::Tolerance();
+        }
+
+        FixedVector3 GetNormalized() const noexcept
+        {
+            FixedVector3 result = *this;
+            result.Normalize();
+            return result;
+        }
+
+        FixedVector3 GetRotated(Q degrees, const FixedVector3& axis) const noexcept
+        {
+            FixedVector3 result = *this;
+            result.Rotate(degrees, axis);
+            return result;
+        }
+
+        Q Length() const noexcept
+        {
+            return Q::Sqrt(LengthSquared());
+        }
+
+        constexpr Q LengthSquared() const noexcept
+        {
+            return (x * x) + (y * y) + (z * z);
+        }
+
+        constexpr Q Dot(const FixedVector3& other) const noexcept
+        {
+            return (x * other.x) + (y * other.y) + (z * other.z);
+        }
+
+        constexpr FixedVector3 Cross(const FixedVector3& other) const noexcept
+        {
+            return
+            {
+                (y * other.z) - (z * other.y),
+                (z * other.x) - (x * other.z),
+                (x * other.y) - (y * other.x)
+            };
+        }
+
+        constexpr bool IsNearlyEqual(const FixedVector3& other, Q epsilon = Q::Tolerance()) const noexcept
+        {
+            return DistanceSquared(*this, other) < (epsilon * epsilon);
+        }
+
+        std::string ToString() const
+        {
+            return std::format("{}", *this);
+        }
+
+        // -------------------------
+        // Utilities
+        // -------------------------
+
+        static Q Distance(const FixedVector3& a, const FixedVector3& b) noexcept
+        {
+            return (b - a).Length();
+        }
+
+        static constexpr Q DistanceSquared(const FixedVector3& a, const FixedVector3& b) noexcept
+        {
+            return (b - a).LengthSquared();
+        }
+
+        static constexpr FixedVector3 Reflect(const FixedVector3& v, const FixedVector3& n) noexcept
+        {
+            return v - n * (Q(2) * v.Dot(n));
+        }
+
+        static constexpr FixedVector3 Lerp(const FixedVector3& a, const FixedVector3& b, Q t) noexcept
+        {
+            return { Q::Lerp(a.x, b.x, t), Q::Lerp(a.y, b.y, t), Q::Lerp(a.z, b.z, t) };
+        }
+
+        static Q Angle(const FixedVector3& a, const FixedVector3& b) noexcept
+        {
+            return Q::Atan2(a.Cross(b).Length(), a.Dot(b));
+        }
+
+        static Q SignedAngle(const FixedVector3& a, const FixedVector3& b, const FixedVector3& axis) noexcept
+        {
+            FixedVector3 cross = a.Cross(b);
+            Q degrees = Q::Atan2(cross.Length(), a.Dot(b));
+            return (cross.Dot(axis) < Q()) ? -degrees : degrees;
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const FixedVector3& other) const noexcept = default;
+
+        constexpr FixedVector3 operator+(const FixedVector3& other) const noexcept
+        {
+            return { x + other.x, y + other.y, z + other.z };
+        }
+
+        constexpr FixedVector3 operator-(const FixedVector3& other) const noexcept
+        {
+            return { x - other.x, y - other.y, z - other.z };
+        }
+
+        constexpr FixedVector3 operator*(const FixedVector3& other) const noexcept
+        {
+            return { x * other.x, y * other.y, z * other.z };
+        }
+
+        constexpr FixedVector3 operator*(Q scalar) const noexcept
+        {
+            return { x * scalar, y * scalar, z * scalar };
+        }
+
+        constexpr FixedVector3 operator/(Q scalar) const noexcept
+        {
+            return { x / scalar, y / scalar, z / scalar };
+        }
+
+        constexpr FixedVector3 operator-() const noexcept
+        {
+            return { -x, -y, -z };
+        }
+
+        constexpr FixedVector3& operator+=(const FixedVector3& other) noexcept
+        {
+            x += other.x;
+            y += other.y;
+            z += other.z;
+            return *this;
+        }
+
+        constexpr FixedVector3& operator-=(const FixedVector3& other) noexcept
+        {
+            x -= other.x;
+            y -= other.y;
+            z -= other.z;
+            return *this;
+        }
+
+        constexpr FixedVector3& operator*=(Q scalar) noexcept
+        {
+            x *= scalar;
+            y *= scalar;
+            z *= scalar;
+            return *this;
+        }
+
+        constexpr FixedVector3& operator/=(Q scalar) noexcept
+        {
+            x /= scalar;
+            y /= scalar;
+            z /= scalar;
+            return *this;
+        }
+
+        constexpr Q& operator[](int index) noexcept
+        {
+            assert(index >= 0 && index < 3);
+            return (&x)[index];
+        }
+
+        constexpr const Q& operator[](int index) const noexcept
+        {
+            assert(index >= 0 && index < 3);
+            return (&x)[index];
+        }
+
+        constexpr friend FixedVector3 operator*(Q scalar, const FixedVector3& v) noexcept
+        {
+            return v * scalar;
+        }
+    };
+
+    using Q16Vector3 = FixedVector3<Q16_16>;
+    using Q32Vector3 = FixedVector3<Q32_32>;
+}
+
+template<Vec23::FixedPoint Q>
+struct std::formatter<Vec23::FixedVector3<Q>> : std::formatter<Q>
+{
+    template<typename FormatContext>
+    auto format(const Vec23::FixedVector3<Q>& v, FormatContext& ctx) const
+    {
+        auto out = ctx.out();
+        *out++ = '(';
+        ctx.advance_to(out);
+        out = std::formatter<Q>::format(v.x, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<Q>::format(v.y, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<Q>::format(v.z, ctx);
+        *out++ = ')';
+        return out;
+    }
+};
@@ -0,0 +1,211 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Define VEC23_INSTRUMENTATION (or configure with -DVEC23_INSTRUMENTATION=ON) to count calls to the hot-path
+// operations below and how often their degenerate fallbacks trigger. Without it VEC23_COUNT expands to
+// nothing and every report is empty.
+// VEC23_COUNT_N adds a tally at once, for batch kernels that count locally and report per chunk.
+#if defined(VEC23_INSTRUMENTATION)
+#define VEC23_COUNT(counter) ::Vec23::Detail::Count(::Vec23::Counter::counter)
+#define VEC23_COUNT_N(counter, amount) ::Vec23::Detail::Count(::Vec23::Counter::counter, static_cast<std::uint64_t>(amount))
+#else
+#define VEC23_COUNT(counter) static_cast<void>(0)
+#define VEC23_COUNT_N(counter, amount) static_cast<void>(amount)
+#endif
+
+namespace Vec23
+{
+    enum class Counter : std::uint8_t
+    {
+        Vector2Normalize,
+        Vector2NormalizeDegenerate,
+        Vector3Normalize,
+        Vector3NormalizeDegenerate,
+        VectorNNormalize,
+        VectorNNormalizeDegenerate,
+        QuaternionNormalize,
+        QuaternionNormalizeDegenerate,
+        QuaternionInverse,
+        QuaternionInverseDegenerate,
+        QuaternionSlerp,
+        QuaternionSlerpLerpFallback,
+        QuaternionToEuler,
+        QuaternionToEulerGimbalNorth,
+        QuaternionToEulerGimbalSouth,
+        Count
+    };
+
+    inline constexpr std::size_t kCounterCount = static_cast<std::size_t>(Counter::Count);
+
+    constexpr std::string_view CounterName(Counter counter) noexcept
+    {
+        constexpr std::array<std::string_view, kCounterCount> kNames = {
+            "Vector2::Normalize",
+            "Vector2::Normalize (zero length)",
+            "Vector3::Normalize",
+            "Vector3::Normalize (zero length)",
+            "VectorN::Normalize",
+            "VectorN::Normalize (zero length)",
+            "Quaternion::Normalize",
+            "Quaternion::Normalize (zero length)",
+            "Quaternion::Inverse",
+            "Quaternion::Inverse (zero length)",
+            "Quaternion::Slerp",
+            "Quaternion::Slerp (Lerp fallback)",
+            "Quaternion::ToEuler",
+            "Quaternion::ToEuler (gimbal lock, +90 pitch)",
+            "Quaternion::ToEuler (gimbal lock, -90 pitch)"
+        };
+        return (counter < Counter::Count) ? kNames[static_cast<std::size_t>(counter)] : std::string_view();
+    }
+
+    // Totals over all threads, including threads that have already exited.
+    struct CounterReport
+    {
+        std::array<std::uint64_t, kCounterCount> counts{};
+
+        std::uint64_t operator[](Counter counter) const noexcept
+        {
+            return counts[static_cast<std::size_t>(counter)];
+        }
+
+        // One "name: count" line per counter that fired.
+        std::string ToString() const
+        {
+            std::string result;
+            for (std::size_t i = 0; i < kCounterCount; ++i)
+            {
+                if (counts[i] != 0)
+                {
+                    result += std::format("{}: {}\n", CounterName(static_cast<Counter>(i)), counts[i]);
+                }
+            }
+            return result;
+        }
+    };
+
+    namespace Detail
+    {
+#if defined(VEC23_INSTRUMENTATION)
+        // Each thread only ever writes its own counters, so an increment is a relaxed load and store rather
+        // than a locked read-modify-write; the atomics are there so reports can read them from other threads.
+        struct ThreadCounters
+        {
+            std::array<std::atomic<std::uint64_t>, kCounterCount> counts{};
+
+            ThreadCounters();
+            ~ThreadCounters();
+        };
+
+        struct CounterRegistry
+        {
+            std::mutex mutex;
+            std::vector<const ThreadCounters*> threads;
+            std::array<std::uint64_t, kCounterCount> retired{};
+            std::array<std::uint64_t, kCounterCount> baseline{};
+
+            static CounterRegistry& Get()
+            {
+                static CounterRegistry registry;
+                return registry;
+            }
+
+            // Caller holds the mutex.
+            std::array<std::uint64_t, kCounterCount> Totals() const noexcept
+            {
+                std::array<std::uint64_t, kCounterCount> totals = retired;
+                for (const ThreadCounters* thread : threads)
+                {
+                    for (std::size_t i = 0; i < kCounterCount; ++i)
+                    {
+                        totals[i] += thread->counts[i].load(std::memory_order_relaxed);
+                    }
+                }
+                return totals;
+            }
+        };
+
+        inline ThreadCounters::ThreadCounters()
+        {
+            CounterRegistry& registry = CounterRegistry::Get();
+            std::lock_guard lock(registry.mutex);
+            registry.threads.push_back(this);
+        }
+
+        inline ThreadCounters::~ThreadCounters()
+        {
+            CounterRegistry& registry = CounterRegistry::Get();
+            std::lock_guard lock(registry.mutex);
+            for (std::size_t i = 0; i < kCounterCount; ++i)
+            {
+                registry.retired[i] += counts[i].load(std::memory_order_relaxed);
+            }
+            std::erase(registry.threads, this);
+        }
+
+        inline void Record(Counter counter, std::uint64_t amount) noexcept
+        {
+            thread_local ThreadCounters local;
+            std::atomic<std::uint64_t>& count = local.counts[static_cast<std::size_t>(counter)];
+            count.store(count.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        // Usable from constexpr functions: constant evaluation counts nothing.
+        constexpr void Count(Counter counter, std::uint64_t amount = 1) noexcept
+        {
+            if (!std::is_constant_evaluated())
+            {
+                Record(counter, amount);
+            }
+        }
+#endif
+    }
+
+    struct Instrumentation
+    {
+#if defined(VEC23_INSTRUMENTATION)
+        static constexpr bool kEnabled = true;
+#else
+        static constexpr bool kEnabled = false;
+#endif
+
+        // Counts since the last Reset. Reading other threads' counters is not synchronised with their updates,
+        // so a report taken while they run may miss their most recent increments.
+        static CounterReport Report()
+        {
+            CounterReport report;
+#if defined(VEC23_INSTRUMENTATION)
+            Detail::CounterRegistry& registry = Detail::CounterRegistry::Get();
+            std::lock_guard lock(registry.mutex);
+            std::array<std::uint64_t, kCounterCount> totals = registry.Totals();
+            for (std::size_t i = 0; i < kCounterCount; ++i)
+            {
+                report.counts[i] = totals[i] - registry.baseline[i];
+            }
+#endif
+            return report;
+        }
+
+        // Threads own their counters, so a reset moves the report's baseline instead of clearing them.
+        static void Reset()
+        {
+#if defined(VEC23_INSTRUMENTATION)
+            Detail::CounterRegistry& registry = Detail::CounterRegistry::Get();
+            std::lock_guard lock(registry.mutex);
+            registry.baseline = registry.Totals();
+#endif
+        }
+    };
+}
@@ -0,0 +1,357 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BatchMath.h"
+#include "Constants.h"
+#include "Instrumentation.h"
+#include "Parallel.h"
+#include "Quaternion.h"
+#include "SoA.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    // Fixed-capacity ring of timestamped position/rotation snapshots per entity, for rendering remote
+    // entities between the updates they receive. All rings share flat SoA columns indexed by
+    // entity * capacity + slot, so there are no per-entity containers. Samples newer than the latest
+    // snapshot are extrapolated from the last two, by at most the extrapolation limit; samples older than
+    // the oldest snapshot hold it.
+    template<std::floating_point T>
+    class InterpolationBuffer
+    {
+    public:
+        InterpolationBuffer(std::size_t entityCount, std::size_t capacity, T extrapolationLimit = kZero<T>)
+            : m_positions(entityCount * capacity), m_rotations(entityCount * capacity), m_times(entityCount * capacity),
+              m_newest(entityCount), m_counts(entityCount), m_capacity(capacity), m_extrapolationLimit(extrapolationLimit)
+        {
+            assert(capacity > 0);
+        }
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        // Snapshots must arrive in time order; late or duplicate ones are rejected.
+        bool Push(std::size_t entity, T time, const Vector3<T>& position, const Quaternion<T>& rotation) noexcept
+        {
+            assert(entity < EntityCount());
+            std::uint32_t count = m_counts[entity];
+            std::size_t base = entity * m_capacity;
+            if (count > 0 && time <= m_times[base + m_newest[entity]])
+            {
+                return false;
+            }
+
+            std::uint32_t slot = (count == 0) ? 0 : static_cast<std::uint32_t>((m_newest[entity] + 1) % m_capacity);
+            m_positions.Set(base + slot, position);
+            m_rotations.Set(base + slot, rotation);
+            m_times[base + slot] = time;
+            m_newest[entity] = slot;
+            m_counts[entity] = static_cast<std::uint32_t>(std::min<std::size_t>(count + 1, m_capacity));
+            return true;
+        }
+
+        void Clear(std::size_t entity) noexcept
+        {
+            assert(entity < EntityCount());
+            m_counts[entity] = 0;
+        }
+
+        void Clear() noexcept
+        {
+            std::fill(m_counts.begin(), m_counts.end(), 0u);
+        }
+
+        void SetExtrapolationLimit(T limit) noexcept
+        {
+            m_extrapolationLimit = limit;
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        std::size_t EntityCount() const noexcept
+        {
+            return m_counts.size();
+        }
+
+        std::size_t Capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        T ExtrapolationLimit() const noexcept
+        {
+            return m_extrapolationLimit;
+        }
+
+        std::size_t SnapshotCount(std::size_t entity) const noexcept
+        {
+            assert(entity < EntityCount());
+            return m_counts[entity];
+        }
+
+        // Entities without snapshots sample as the origin with the identity rotation and return false.
+        bool Sample(std::size_t entity, T time, Vector3<T>& outPosition, Quaternion<T>& outRotation) const noexcept
+        {
+            Bracket bracket = Find(entity, time);
+            switch (bracket.kind)
+            {
+            case BracketKind::Empty:
+                outPosition = Vector3<T>();
+                outRotation = Quaternion<T>::Identity();
+                return false;
+            case BracketKind::Hold:
+                outPosition = m_positions.Get(bracket.newer);
+                outRotation = m_rotations.Get(bracket.newer);
+                return true;
+            case BracketKind::Interpolate:
+                outPosition = Vector3<T>::Lerp(m_positions.Get(bracket.older), m_positions.Get(bracket.newer), bracket.t);
+                outRotation = Quaternion<T>::Slerp(m_rotations.Get(bracket.older), m_rotations.Get(bracket.newer), bracket.t);
+                return true;
+            case BracketKind::Extrapolate:
+                outPosition = Vector3<T>::Lerp(m_positions.Get(bracket.older), m_positions.Get(bracket.newer), bracket.t);
+                outRotation = Extrapolate(m_rotations.Get(bracket.older), m_rotations.Get(bracket.newer), bracket.t - kOne<T>);
+                return true;
+            }
+            return false;
+        }
+
+        // Samples every entity at the same time, in parallel. The columns are entity-major, so each tile first
+        // gathers its entities' bracketing snapshots into local arrays; Lerp and Slerp then run as branch-free
+        // passes over them. Rotations match the single-entity Sample to within the batch trig error, and only
+        // extrapolated rows go back through the scalar path.
+        void Sample(T time, Vector3SoA<T>& outPositions, QuaternionSoA<T>& outRotations) const
+        {
+            outPositions.Resize(EntityCount());
+            outRotations.Resize(EntityCount());
+
+            T* outX = outPositions.x.data();
+            T* outY = outPositions.y.data();
+            T* outZ = outPositions.z.data();
+            T* outW = outRotations.w.data();
+            T* outQX = outRotations.x.data();
+            T* outQY = outRotations.y.data();
+            T* outQZ = outRotations.z.data();
+
+            Detail::ParallelFor(EntityCount(), [&](std::size_t begin, std::size_t end)
+            {
+                constexpr std::size_t kTile = Detail::kBatchTile;
+                T fromX[kTile], fromY[kTile], fromZ[kTile], toX[kTile], toY[kTile], toZ[kTile];
+                T fromW[kTile], fromQX[kTile], fromQY[kTile], fromQZ[kTile], toW[kTile], toQX[kTile], toQY[kTile], toQZ[kTile];
+                T weight[kTile], blend[kTile];
+                std::size_t extrapolated[kTile];
+                std::size_t slerps = 0;
+                std::size_t lerpFallbacks = 0;
+
+                for (std::size_t first = begin; first < end; first += kTile)
+                {
+                    std::size_t count = std::min(kTile, end - first);
+                    std::size_t extrapolatedCount = 0;
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        Bracket bracket = Find(first + i, time);
+                        if (bracket.kind == BracketKind::Empty)
+                        {
+                            fromX[i] = toX[i] = fromY[i] = toY[i] = fromZ[i] = toZ[i] = kZero<T>;
+                            fromW[i] = toW[i] = kOne<T>;
+                            fromQX[i] = toQX[i] = fromQY[i] = toQY[i] = fromQZ[i] = toQZ[i] = kZero<T>;
+                        }
+                        else
+                        {
+                            fromX[i] = m_positions.x[bracket.older];
+                            fromY[i] = m_positions.y[bracket.older];
+                            fromZ[i] = m_positions.z[bracket.older];
+                            toX[i] = m_positions.x[bracket.newer];
+                            toY[i] = m_positions.y[bracket.newer];
+                            toZ[i] = m_positions.z[bracket.newer];
+                            fromW[i] = m_rotations.w[bracket.older];
+                            fromQX[i] = m_rotations.x[bracket.older];
+                            fromQY[i] = m_rotations.y[bracket.older];
+                            fromQZ[i] = m_rotations.z[bracket.older];
+                            toW[i] = m_rotations.w[bracket.newer];
+                            toQX[i] = m_rotations.x[bracket.newer];
+                            toQY[i] = m_rotations.y[bracket.newer];
+                            toQZ[i] = m_rotations.z[bracket.newer];
+                        }
+
+                        // Held and empty rows gather the same snapshot twice and keep it as is.
+                        weight[i] = bracket.t;
+                        blend[i] = (bracket.kind == BracketKind::Interpolate) ? kOne<T> : kZero<T>;
+                        slerps += (bracket.kind == BracketKind::Interpolate);
+                        if (bracket.kind == BracketKind::Extrapolate)
+                        {
+                            extrapolated[extrapolatedCount++] = i;
+                        }
+                    }
+
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        outX[first + i] = Detail::BatchLerp(fromX[i], toX[i], weight[i]);
+                        outY[first + i] = Detail::BatchLerp(fromY[i], toY[i], weight[i]);
+                        outZ[first + i] = Detail::BatchLerp(fromZ[i], toZ[i], weight[i]);
+                    }
+
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        T t = std::clamp(weight[i], kZero<T>, kOne<T>);
+                        T dot = fromW[i] * toW[i] + fromQX[i] * toQX[i] + fromQY[i] * toQY[i] + fromQZ[i] * toQZ[i];
+                        T sign = (dot < kZero<T>) ? -kOne<T> : kOne<T>;
+                        dot = std::min(dot * sign, kOne<T>);
+                        T bw = toW[i] * sign;
+                        T bx = toQX[i] * sign;
+                        T by = toQY[i] * sign;
+                        T bz = toQZ[i] * sign;
+
+                        // Nearly parallel rotations take Quaternion::Lerp's normalized blend instead.
+                        bool linear = dot > kOne<T> - kToleranceEpsilon<T>;
+                        lerpFallbacks += linear && blend[i] != kZero<T>;
+
+                        T sinTheta = std::sqrt(kOne<T> - dot * dot);
+                        T thetaDegrees = Detail::BatchAtan2(sinTheta, dot) * kRadiansToDegrees<T>;
+                        T sinFrom, sinTo, unused;
+                        Detail::BatchSinCos((kOne<T> - t) * thetaDegrees, sinFrom, unused);
+                        Detail::BatchSinCos(t * thetaDegrees, sinTo, unused);
+                        T invSin = kOne<T> / (linear ? kOne<T> : sinTheta);
+                        T scaleFrom = linear ? kOne<T> - t : sinFrom * invSin;
+                        T scaleTo = linear ? t : sinTo * invSin;
+
+                        T rw = scaleFrom * fromW[i] + scaleTo * bw;
+                        T rx = scaleFrom * fromQX[i] + scaleTo * bx;
+                        T ry = scaleFrom * fromQY[i] + scaleTo * by;
+                        T rz = scaleFrom * fromQZ[i] + scaleTo * bz;
+                        T lengthSq = rw * rw + rx * rx + ry * ry + rz * rz;
+                        T invLength = linear ? kOne<T> / std::sqrt(lengthSq > kSafetyEpsilon<T> ? lengthSq : kOne<T>) : kOne<T>;
+
+                        bool keep = blend[i] == kZero<T>;
+                        outW[first + i] = keep ? fromW[i] : rw * invLength;
+                        outQX[first + i] = keep ? fromQX[i] : rx * invLength;
+                        outQY[first + i] = keep ? fromQY[i] : ry * invLength;
+                        outQZ[first + i] = keep ? fromQZ[i] : rz * invLength;
+                    }
+
+                    for (std::size_t k = 0; k < extrapolatedCount; ++k)
+                    {
+                        std::size_t i = extrapolated[k];
+                        Quaternion<T> rotation = Extrapolate({ fromW[i], fromQX[i], fromQY[i], fromQZ[i] },
+                            { toW[i], toQX[i], toQY[i], toQZ[i] }, weight[i] - kOne<T>);
+                        outW[first + i] = rotation.w;
+                        outQX[first + i] = rotation.x;
+                        outQY[first + i] = rotation.y;
+                        outQZ[first + i] = rotation.z;
+                    }
+                }
+
+                VEC23_COUNT_N(QuaternionSlerp, slerps);
+                VEC23_COUNT_N(QuaternionSlerpLerpFallback, lerpFallbacks);
+            }, outPositions.Resource());
+        }
+
+    private:
+        Vector3SoA<T> m_positions;
+        QuaternionSoA<T> m_rotations;
+        std::vector<T> m_times;
+        std::vector<std::uint32_t> m_newest;
+        std::vector<std::uint32_t> m_counts;
+        std::size_t m_capacity;
+        T m_extrapolationLimit;
+
+        enum class BracketKind : std::uint8_t
+        {
+            Empty,
+            Hold,
+            Interpolate,
+            Extrapolate
+        };
+
+        // Column indices of the snapshots around a sample time, and the Lerp parameter between them.
+        struct Bracket
+        {
+            std::size_t older;
+            std::size_t newer;
+            T t;
+            BracketKind kind;
+        };
+
+        std::uint32_t SlotBefore(std::uint32_t slot) const noexcept
+        {
+            return static_cast<std::uint32_t>((slot + m_capacity - 1) % m_capacity);
+        }
+
+        Bracket Find(std::size_t entity, T time) const noexcept
+        {
+            assert(entity < EntityCount());
+            std::uint32_t count = m_counts[entity];
+            if (count == 0)
+            {
+                return { 0, 0, kZero<T>, BracketKind::Empty };
+            }
+
+            std::size_t base = entity * m_capacity;
+            std::size_t newer = base + m_newest[entity];
+            if (count == 1)
+            {
+                return { newer, newer, kZero<T>, BracketKind::Hold };
+            }
+
+            if (time >= m_times[newer])
+            {
+                std::size_t older = base + SlotBefore(m_newest[entity]);
+                T clamped = std::min(time, m_times[newer] + m_extrapolationLimit);
+                T t = (clamped - m_times[older]) / (m_times[newer] - m_times[older]);
+                return { older, newer, t, BracketKind::Extrapolate };
+            }
+
+            std::uint32_t slot = m_newest[entity];
+            for (std::uint32_t k = 1; k < count; ++k)
+            {
+                std::uint32_t previous = SlotBefore(slot);
+                std::size_t older = base + previous;
+                if (m_times[older] <= time)
+                {
+                    std::size_t next = base + slot;
+                    T t = (time - m_times[older]) / (m_times[next] - m_times[older]);
+                    return { older, next, t, BracketKind::Interpolate };
+                }
+                slot = previous;
+            }
+
+            return { base + slot, base + slot, kZero<T>, BracketKind::Hold };
+        }
+
+        // Continues the rotation from older to newer by overshoot steps, the same factor positions are
+        // extrapolated by. Slerp clamps its parameter to one step, so the delta rotation is scaled through its
+        // axis-angle form instead, taken along the shorter arc.
+        static Quaternion<T> Extrapolate(const Quaternion<T>& older, const Quaternion<T>& newer, T overshoot) noexcept
+        {
+            if (overshoot <= kZero<T>)
+            {
+                return newer;
+            }
+
+            Quaternion<T> delta = newer * older.GetInversed();
+            if (delta.w < kZero<T>)
+            {
+                delta = -delta;
+            }
+
+            Vector3<T> axis;
+            T degrees;
+            delta.ToAxisAngle(axis, degrees);
+            return Quaternion<T>::FromAxisAngle(axis, degrees * overshoot) * newer;
+        }
+    };
+
+    using FInterpolationBuffer = InterpolationBuffer<float>;
+    using DInterpolationBuffer = InterpolationBuffer<double>;
+    using LDInterpolationBuffer = InterpolationBuffer<long double>;
+}
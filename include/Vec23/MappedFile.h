@@ -0,0 +1,153 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Vec23
+{
+    class MappedFile
+    {
+    public:
+        MappedFile() noexcept = default;
+
+        explicit MappedFile(const std::filesystem::path& path) noexcept
+        {
+            Open(path);
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Close();
+                m_data = std::exchange(other.m_data, nullptr);
+                m_size = std::exchange(other.m_size, 0);
+#if defined(_WIN32)
+                m_file = std::exchange(other.m_file, INVALID_HANDLE_VALUE);
+                m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+            }
+            return *this;
+        }
+
+        ~MappedFile()
+        {
+            Close();
+        }
+
+        bool Open(const std::filesystem::path& path) noexcept
+        {
+            Close();
+
+#if defined(_WIN32)
+            m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            LARGE_INTEGER size;
+            if (m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+            {
+                Close();
+                return false;
+            }
+
+            m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            m_data = m_mapping ? MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+            int descriptor = ::open(path.c_str(), O_RDONLY);
+            struct stat info;
+            if (descriptor < 0 || ::fstat(descriptor, &info) != 0 || info.st_size == 0)
+            {
+                if (descriptor >= 0)
+                {
+                    ::close(descriptor);
+                }
+                return false;
+            }
+
+            void* data = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, descriptor, 0);
+            ::close(descriptor);
+            m_data = (data == MAP_FAILED) ? nullptr : data;
+            m_size = static_cast<std::size_t>(info.st_size);
+#endif
+
+            if (!m_data)
+            {
+                Close();
+                return false;
+            }
+
+            return true;
+        }
+
+        void Close() noexcept
+        {
+#if defined(_WIN32)
+            if (m_data)
+            {
+                UnmapViewOfFile(m_data);
+            }
+            if (m_mapping)
+            {
+                CloseHandle(m_mapping);
+            }
+            if (m_file != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(m_file);
+            }
+            m_mapping = nullptr;
+            m_file = INVALID_HANDLE_VALUE;
+#else
+            if (m_data)
+            {
+                ::munmap(m_data, m_size);
+            }
+#endif
+            m_data = nullptr;
+            m_size = 0;
+        }
+
+        bool IsOpen() const noexcept
+        {
+            return m_data != nullptr;
+        }
+
+        std::span<const std::byte> Bytes() const noexcept
+        {
+            return { static_cast<const std::byte*>(m_data), m_size };
+        }
+
+    private:
+        void* m_data = nullptr;
+        std::size_t m_size = 0;
+#if defined(_WIN32)
+        HANDLE m_file = INVALID_HANDLE_VALUE;
+        HANDLE m_mapping = nullptr;
+#endif
+    };
+}
@@ -0,0 +1,82 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <memory_resource>
+#include <numeric>
+#include <vector>
+
+namespace Vec23::Detail
+{
+    inline constexpr std::size_t kParallelGrain = 16384;
+
+    inline std::size_t ChunkCount(std::size_t count) noexcept
+    {
+        return (count + kParallelGrain - 1) / kParallelGrain;
+    }
+
+    // The scheduling buffers come from resource, so callers holding an arena keep them off the global heap.
+    template<typename Func>
+    void ParallelForEach(std::size_t count, Func&& func,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+    {
+        std::pmr::vector<std::size_t> indices(count, resource);
+        std::iota(indices.begin(), indices.end(), std::size_t(0));
+        std::for_each(std::execution::par, indices.begin(), indices.end(), [&](std::size_t index)
+        {
+            func(index);
+        });
+    }
+
+    template<typename Func>
+    void ParallelFor(std::size_t count, Func&& func,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (count <= kParallelGrain)
+        {
+            func(std::size_t(0), count);
+            return;
+        }
+
+        ParallelForEach(ChunkCount(count), [&](std::size_t chunk)
+        {
+            std::size_t begin = chunk * kParallelGrain;
+            func(begin, std::min(begin + kParallelGrain, count));
+        }, resource);
+    }
+
+    template<typename R, typename Func, typename Combine>
+    R ParallelReduce(std::size_t count, R identity, Func&& func, Combine&& combine,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+    {
+        if (count <= kParallelGrain)
+        {
+            return count > 0 ? func(std::size_t(0), count) : identity;
+        }
+
+        std::pmr::vector<R> partials(ChunkCount(count), identity, resource);
+        ParallelForEach(partials.size(), [&](std::size_t chunk)
+        {
+            std::size_t begin = chunk * kParallelGrain;
+            partials[chunk] = func(begin, std::min(begin + kParallelGrain, count));
+        }, resource);
+
+        for (std::size_t stride = 1; stride < partials.size(); stride *= 2)
+        {
+            for (std::size_t i = 0; i + stride < partials.size(); i += stride * 2)
+            {
+                partials[i] = combine(partials[i], partials[i + stride]);
+            }
+        }
+
+        return partials[0];
+    }
+}
@@ -0,0 +1,354 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include "Constants.h"
+#include "Parallel.h"
+#include "Quaternion.h"
+#include "StridedView.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    namespace Detail
+    {
+        template<std::floating_point T, int N>
+        struct CompensatedSum
+        {
+            T sum[N] = {};
+            T compensation[N] = {};
+
+            constexpr void Add(int index, T value) noexcept
+            {
+                T total = sum[index] + value;
+                if (std::abs(sum[index]) >= std::abs(value))
+                {
+                    compensation[index] += (sum[index] - total) + value;
+                }
+                else
+                {
+                    compensation[index] += (value - total) + sum[index];
+                }
+                sum[index] = total;
+            }
+
+            constexpr T Get(int index) const noexcept
+            {
+                return sum[index] + compensation[index];
+            }
+
+            static constexpr CompensatedSum Combine(const CompensatedSum& a, const CompensatedSum& b) noexcept
+            {
+                CompensatedSum result = a;
+                for (int i = 0; i < N; ++i)
+                {
+                    result.Add(i, b.sum[i]);
+                    result.compensation[i] += b.compensation[i];
+                }
+                return result;
+            }
+        };
+
+        // TwoSum accumulation in kLanes independent lanes per term. TwoSum is branch-free and every lane only
+        // depends on itself, so adding a tile is a few vector operations per term rather than a serial
+        // dependency chain through one accumulator, and it needs no reassociation from the compiler.
+        template<std::floating_point T, int N>
+        struct LaneCompensatedSum
+        {
+            static constexpr int kLanes = 8;
+
+            T sum[N][kLanes] = {};
+            T compensation[N][kLanes] = {};
+
+            void Add(const T (&values)[N][kLanes]) noexcept
+            {
+                for (int n = 0; n < N; ++n)
+                {
+                    for (int lane = 0; lane < kLanes; ++lane)
+                    {
+                        T total = sum[n][lane] + values[n][lane];
+                        T rounded = total - sum[n][lane];
+                        compensation[n][lane] += (sum[n][lane] - (total - rounded)) + (values[n][lane] - rounded);
+                        sum[n][lane] = total;
+                    }
+                }
+            }
+
+            CompensatedSum<T, N> Fold() const noexcept
+            {
+                CompensatedSum<T, N> result;
+                for (int n = 0; n < N; ++n)
+                {
+                    for (int lane = 0; lane < kLanes; ++lane)
+                    {
+                        result.Add(n, sum[n][lane]);
+                        result.compensation[n] += compensation[n][lane];
+                    }
+                }
+                return result;
+            }
+        };
+
+        // Sums the N terms stage(i, tile, lane) writes for each point in [begin, end), a tile of kLanes points
+        // at a time. The last tile is padded with zeros, which TwoSum adds exactly.
+        template<std::floating_point T, int N, typename Stage>
+        CompensatedSum<T, N> LaneSum(std::size_t begin, std::size_t end, Stage stage) noexcept
+        {
+            constexpr int kLanes = LaneCompensatedSum<T, N>::kLanes;
+
+            LaneCompensatedSum<T, N> accumulator;
+            for (std::size_t first = begin; first < end; first += kLanes)
+            {
+                T tile[N][kLanes] = {};
+                int count = static_cast<int>(std::min<std::size_t>(kLanes, end - first));
+                for (int lane = 0; lane < count; ++lane)
+                {
+                    stage(first + static_cast<std::size_t>(lane), tile, lane);
+                }
+                accumulator.Add(tile);
+            }
+            return accumulator.Fold();
+        }
+
+        template<std::floating_point T, int N>
+        void SymmetricEigen(T (&a)[N][N], T (&v)[N][N]) noexcept
+        {
+            constexpr int kJacobiSweeps = 32;
+
+            for (int i = 0; i < N; ++i)
+            {
+                for (int j = 0; j < N; ++j)
+                {
+                    v[i][j] = (i == j) ? kOne<T> : kZero<T>;
+                }
+            }
+
+            for (int sweep = 0; sweep < kJacobiSweeps; ++sweep)
+            {
+                T offDiagonal = kZero<T>;
+                T diagonal = kZero<T>;
+                for (int p = 0; p < N; ++p)
+                {
+                    diagonal += a[p][p] * a[p][p];
+                    for (int q = p + 1; q < N; ++q)
+                    {
+                        offDiagonal += a[p][q] * a[p][q];
+                    }
+                }
+
+                if (offDiagonal <= std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon() * diagonal)
+                {
+                    break;
+                }
+
+                for (int p = 0; p < N - 1; ++p)
+                {
+                    for (int q = p + 1; q < N; ++q)
+                    {
+                        if (a[p][q] == kZero<T>)
+                        {
+                            continue;
+                        }
+
+                        T theta = (a[q][q] - a[p][p]) / (kTwo<T> * a[p][q]);
+                        T t = std::copysign(kOne<T>, theta) / (std::abs(theta) + std::sqrt(theta * theta + kOne<T>));
+                        T c = kOne<T> / std::sqrt(t * t + kOne<T>);
+                        T s = t * c;
+
+                        for (int k = 0; k < N; ++k)
+                        {
+                            T akp = a[k][p];
+                            T akq = a[k][q];
+                            a[k][p] = c * akp - s * akq;
+                            a[k][q] = s * akp + c * akq;
+                        }
+
+                        for (int k = 0; k < N; ++k)
+                        {
+                            T apk = a[p][k];
+                            T aqk = a[q][k];
+                            a[p][k] = c * apk - s * aqk;
+                            a[q][k] = s * apk + c * aqk;
+                        }
+
+                        for (int k = 0; k < N; ++k)
+                        {
+                            T vkp = v[k][p];
+                            T vkq = v[k][q];
+                            v[k][p] = c * vkp - s * vkq;
+                            v[k][q] = s * vkp + c * vkq;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    template<std::floating_point T>
+    struct Covariance3
+    {
+        T xx;
+        T xy;
+        T xz;
+        T yy;
+        T yz;
+        T zz;
+
+        constexpr Covariance3() noexcept : xx(kZero<T>), xy(kZero<T>), xz(kZero<T>), yy(kZero<T>), yz(kZero<T>), zz(kZero<T>) {}
+
+        constexpr Covariance3(T xx, T xy, T xz, T yy, T yz, T zz) noexcept : xx(xx), xy(xy), xz(xz), yy(yy), yz(yz), zz(zz) {}
+
+        void ToPrincipalAxes(Quaternion<T>& outFrame, Vector3<T>& outVariances) const noexcept
+        {
+            T a[3][3] = { { xx, xy, xz }, { xy, yy, yz }, { xz, yz, zz } };
+            T v[3][3];
+
+            Detail::SymmetricEigen(a, v);
+
+            int order[3] = { 0, 1, 2 };
+            std::sort(order, order + 3, [&](int i, int j) { return a[i][i] > a[j][j]; });
+
+            Vector3<T> xAxis(v[0][order[0]], v[1][order[0]], v[2][order[0]]);
+            Vector3<T> yAxis(v[0][order[1]], v[1][order[1]], v[2][order[1]]);
+            Vector3<T> zAxis = xAxis.Cross(yAxis);
+
+            outFrame = Quaternion<T>::FromAxes(xAxis, yAxis, zAxis);
+            outFrame.Normalize();
+            outVariances = { a[order[0]][order[0]], a[order[1]][order[1]], a[order[2]][order[2]] };
+        }
+
+        constexpr bool operator==(const Covariance3& other) const noexcept = default;
+    };
+
+    template<std::floating_point T>
+    struct PointCloud
+    {
+        // The reductions stage per-chunk partial sums in buffers allocated from resource.
+        static Vector3<T> Centroid(std::span<const Vector3<T>> points,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            return CentroidOf(points, resource);
+        }
+
+        static Vector3<T> Centroid(ConstVector3View<T> points,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            return CentroidOf(points, resource);
+        }
+
+        static Covariance3<T> Covariance(std::span<const Vector3<T>> points, const Vector3<T>& centroid,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            return CovarianceOf(points, centroid, resource);
+        }
+
+        static Covariance3<T> Covariance(ConstVector3View<T> points, const Vector3<T>& centroid,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            return CovarianceOf(points, centroid, resource);
+        }
+
+        static Covariance3<T> Covariance(std::span<const Vector3<T>> points,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            return CovarianceOf(points, CentroidOf(points, resource), resource);
+        }
+
+        static Covariance3<T> Covariance(ConstVector3View<T> points,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            return CovarianceOf(points, CentroidOf(points, resource), resource);
+        }
+
+        static Quaternion<T> PrincipalAxes(std::span<const Vector3<T>> points,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            return FrameOf(Covariance(points, resource));
+        }
+
+        static Quaternion<T> PrincipalAxes(ConstVector3View<T> points,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            return FrameOf(Covariance(points, resource));
+        }
+
+    private:
+        template<typename Points>
+        static Vector3<T> CentroidOf(const Points& points, std::pmr::memory_resource* resource)
+        {
+            if (points.empty())
+            {
+                return {};
+            }
+
+            using Sum = Detail::CompensatedSum<T, 3>;
+            Sum sum = Detail::ParallelReduce(points.size(), Sum{}, [&](std::size_t begin, std::size_t end)
+            {
+                return Detail::LaneSum<T, 3>(begin, end, [&](std::size_t i, auto& tile, int lane)
+                {
+                    tile[0][lane] = points[i].x;
+                    tile[1][lane] = points[i].y;
+                    tile[2][lane] = points[i].z;
+                });
+            }, Sum::Combine, resource);
+
+            T invCount = kOne<T> / static_cast<T>(points.size());
+            return Vector3<T>(sum.Get(0), sum.Get(1), sum.Get(2)) * invCount;
+        }
+
+        template<typename Points>
+        static Covariance3<T> CovarianceOf(const Points& points, const Vector3<T>& centroid,
+            std::pmr::memory_resource* resource)
+        {
+            if (points.empty())
+            {
+                return {};
+            }
+
+            using Sum = Detail::CompensatedSum<T, 6>;
+            Sum sum = Detail::ParallelReduce(points.size(), Sum{}, [&](std::size_t begin, std::size_t end)
+            {
+                return Detail::LaneSum<T, 6>(begin, end, [&](std::size_t i, auto& tile, int lane)
+                {
+                    Vector3<T> d = points[i] - centroid;
+                    tile[0][lane] = d.x * d.x;
+                    tile[1][lane] = d.x * d.y;
+                    tile[2][lane] = d.x * d.z;
+                    tile[3][lane] = d.y * d.y;
+                    tile[4][lane] = d.y * d.z;
+                    tile[5][lane] = d.z * d.z;
+                });
+            }, Sum::Combine, resource);
+
+            T invCount = kOne<T> / static_cast<T>(points.size());
+            return
+            {
+                sum.Get(0) * invCount, sum.Get(1) * invCount, sum.Get(2) * invCount,
+                sum.Get(3) * invCount, sum.Get(4) * invCount, sum.Get(5) * invCount
+            };
+        }
+
+        static Quaternion<T> FrameOf(const Covariance3<T>& covariance) noexcept
+        {
+            Quaternion<T> frame;
+            Vector3<T> variances;
+            covariance.ToPrincipalAxes(frame, variances);
+            return frame;
+        }
+    };
+
+    using FCovariance3 = Covariance3<float>;
+    using DCovariance3 = Covariance3<double>;
+    using LDCovariance3 = Covariance3<long double>;
+
+    using FPointCloud = PointCloud<float>;
+    using DPointCloud = PointCloud<double>;
+    using LDPointCloud = PointCloud<long double>;
+}
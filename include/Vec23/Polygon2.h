@@ -0,0 +1,210 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <span>
+#include <vector>
+#include "Constants.h"
+#include "Parallel.h"
+#include "Vector2.h"
+
+namespace Vec23
+{
+    template<std::floating_point T>
+    struct Polygon2
+    {
+        static constexpr T Orientation(const Vector2<T>& origin, const Vector2<T>& a, const Vector2<T>& b) noexcept
+        {
+            return (a - origin).Cross(b - origin);
+        }
+
+        static bool Contains(std::span<const Vector2<T>> polygon, const Vector2<T>& p) noexcept
+        {
+            int winding = 0;
+            for (std::size_t i = 0, count = polygon.size(); i < count; ++i)
+            {
+                const Vector2<T>& a = polygon[i];
+                const Vector2<T>& b = polygon[(i + 1 == count) ? 0 : i + 1];
+                if (a.y <= p.y)
+                {
+                    if (b.y > p.y && Orientation(a, b, p) > kZero<T>)
+                    {
+                        ++winding;
+                    }
+                }
+                else if (b.y <= p.y && Orientation(a, b, p) < kZero<T>)
+                {
+                    --winding;
+                }
+            }
+            return winding != 0;
+        }
+
+        static void Contains(std::span<const Vector2<T>> polygon, std::span<const Vector2<T>> points, std::span<std::uint8_t> outInside)
+        {
+            assert(points.size() == outInside.size());
+
+            Detail::ParallelFor(points.size(), [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    outInside[i] = Contains(polygon, points[i]) ? 1 : 0;
+                }
+            });
+        }
+    };
+
+    template<std::floating_point T>
+    struct ConvexHull2
+    {
+        static std::vector<Vector2<T>> MonotoneChain(std::span<const Vector2<T>> points)
+        {
+            std::vector<Vector2<T>> sorted = DiscardInterior(points);
+            std::sort(std::execution::par, sorted.begin(), sorted.end(), LessXY);
+            sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+            if (sorted.size() < 3)
+            {
+                return sorted;
+            }
+
+            std::vector<Vector2<T>> hull(sorted.size() * 2);
+            std::size_t k = 0;
+            for (const Vector2<T>& p : sorted)
+            {
+                while (k >= 2 && Polygon2<T>::Orientation(hull[k - 2], hull[k - 1], p) <= kZero<T>)
+                {
+                    --k;
+                }
+                hull[k++] = p;
+            }
+
+            for (std::size_t i = sorted.size() - 1, lower = k + 1; i-- > 0;)
+            {
+                while (k >= lower && Polygon2<T>::Orientation(hull[k - 2], hull[k - 1], sorted[i]) <= kZero<T>)
+                {
+                    --k;
+                }
+                hull[k++] = sorted[i];
+            }
+
+            hull.resize(k - 1);
+            return hull;
+        }
+
+        static std::vector<Vector2<T>> Quickhull(std::span<const Vector2<T>> points)
+        {
+            if (points.empty())
+            {
+                return {};
+            }
+
+            auto [minIt, maxIt] = std::minmax_element(std::execution::par, points.begin(), points.end(), LessXY);
+            Vector2<T> a = *minIt;
+            Vector2<T> b = *maxIt;
+            if (a == b)
+            {
+                return { a };
+            }
+
+            std::vector<Vector2<T>> below(points.size());
+            below.erase(std::copy_if(std::execution::par, points.begin(), points.end(), below.begin(),
+                [&](const Vector2<T>& p) { return Polygon2<T>::Orientation(a, b, p) < kZero<T>; }), below.end());
+
+            std::vector<Vector2<T>> above(points.size());
+            above.erase(std::copy_if(std::execution::par, points.begin(), points.end(), above.begin(),
+                [&](const Vector2<T>& p) { return Polygon2<T>::Orientation(a, b, p) > kZero<T>; }), above.end());
+
+            std::vector<Vector2<T>> hull;
+            hull.push_back(a);
+            FindHull(below, a, b, hull);
+            hull.push_back(b);
+            FindHull(above, b, a, hull);
+            return hull;
+        }
+
+    private:
+        static constexpr bool LessXY(const Vector2<T>& a, const Vector2<T>& b) noexcept
+        {
+            return a.x < b.x || (a.x == b.x && a.y < b.y);
+        }
+
+        // Akl-Toussaint: points strictly inside the quadrilateral of axis extremes cannot be on the hull.
+        static std::vector<Vector2<T>> DiscardInterior(std::span<const Vector2<T>> points)
+        {
+            std::vector<Vector2<T>> result;
+            if (points.size() <= Detail::kParallelGrain)
+            {
+                result.assign(points.begin(), points.end());
+                return result;
+            }
+
+            auto [left, right] = std::minmax_element(std::execution::par, points.begin(), points.end(),
+                [](const Vector2<T>& a, const Vector2<T>& b) { return a.x < b.x; });
+            auto [bottom, top] = std::minmax_element(std::execution::par, points.begin(), points.end(),
+                [](const Vector2<T>& a, const Vector2<T>& b) { return a.y < b.y; });
+            Vector2<T> quad[4] = { *left, *bottom, *right, *top };
+
+            result.resize(points.size());
+            auto end = std::copy_if(std::execution::par, points.begin(), points.end(), result.begin(), [&](const Vector2<T>& p)
+            {
+                for (int i = 0; i < 4; ++i)
+                {
+                    if (Polygon2<T>::Orientation(quad[i], quad[(i + 1) % 4], p) <= kZero<T>)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            });
+            result.erase(end, result.end());
+            return result;
+        }
+
+        static void FindHull(std::span<const Vector2<T>> points, const Vector2<T>& p, const Vector2<T>& q, std::vector<Vector2<T>>& hull)
+        {
+            if (points.empty())
+            {
+                return;
+            }
+
+            auto farthest = std::min_element(points.begin(), points.end(), [&](const Vector2<T>& a, const Vector2<T>& b)
+            {
+                return Polygon2<T>::Orientation(p, q, a) < Polygon2<T>::Orientation(p, q, b);
+            });
+            Vector2<T> c = *farthest;
+
+            std::vector<Vector2<T>> first;
+            std::vector<Vector2<T>> second;
+            for (const Vector2<T>& point : points)
+            {
+                if (Polygon2<T>::Orientation(p, c, point) < kZero<T>)
+                {
+                    first.push_back(point);
+                }
+                else if (Polygon2<T>::Orientation(c, q, point) < kZero<T>)
+                {
+                    second.push_back(point);
+                }
+            }
+
+            FindHull(first, p, c, hull);
+            hull.push_back(c);
+            FindHull(second, c, q, hull);
+        }
+    };
+
+    using FPolygon2 = Polygon2<float>;
+    using DPolygon2 = Polygon2<double>;
+    using LDPolygon2 = Polygon2<long double>;
+
+    using FConvexHull2 = ConvexHull2<float>;
+    using DConvexHull2 = ConvexHull2<double>;
+    using LDConvexHull2 = ConvexHull2<long double>;
+}
@@ -3,9 +3,11 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
 #include <concepts>
 #include <format>
 #include "Constants.h"
+#include "Instrumentation.h"
 #include "Vector3.h"
 
 namespace Vec23
@@ -49,6 +51,13 @@ namespace Vec23
             return { cosT, u.x * sinT, u.y * sinT, u.z * sinT };
         }
 
+        static Quaternion FromAxisAngle(const UnitVector3<T>& axis, T degrees) noexcept
+        {
+            T halfRadians = degrees * kHalf<T> * kDegreesToRadians<T>;
+            T sinT = std::sin(halfRadians);
+            return { std::cos(halfRadians), axis.Get().x * sinT, axis.Get().y * sinT, axis.Get().z * sinT };
+        }
+
         static Quaternion FromEuler(T rollDegrees, T pitchDegrees, T yawDegrees) noexcept
         {
             T halfRollRadians = rollDegrees * kHalf<T> * kDegreesToRadians<T>;
@@ -71,12 +80,42 @@ namespace Vec23
             );
         }
 
+        static Quaternion FromAxes(const Vector3<T>& xAxis, const Vector3<T>& yAxis, const Vector3<T>& zAxis) noexcept
+        {
+            T trace = xAxis.x + yAxis.y + zAxis.z;
+            if (trace > kZero<T>)
+            {
+                T s = std::sqrt(trace + kOne<T>) * kTwo<T>;
+                T invS = kOne<T> / s;
+                return { s * kHalf<T> * kHalf<T>, (yAxis.z - zAxis.y) * invS, (zAxis.x - xAxis.z) * invS, (xAxis.y - yAxis.x) * invS };
+            }
+
+            if (xAxis.x > yAxis.y && xAxis.x > zAxis.z)
+            {
+                T s = std::sqrt(kOne<T> + xAxis.x - yAxis.y - zAxis.z) * kTwo<T>;
+                T invS = kOne<T> / s;
+                return { (yAxis.z - zAxis.y) * invS, s * kHalf<T> * kHalf<T>, (yAxis.x + xAxis.y) * invS, (zAxis.x + xAxis.z) * invS };
+            }
+
+            if (yAxis.y > zAxis.z)
+            {
+                T s = std::sqrt(kOne<T> + yAxis.y - xAxis.x - zAxis.z) * kTwo<T>;
+                T invS = kOne<T> / s;
+                return { (zAxis.x - xAxis.z) * invS, (yAxis.x + xAxis.y) * invS, s * kHalf<T> * kHalf<T>, (zAxis.y + yAxis.z) * invS };
+            }
+
+            T s = std::sqrt(kOne<T> + zAxis.z - xAxis.x - yAxis.y) * kTwo<T>;
+            T invS = kOne<T> / s;
+            return { (xAxis.y - yAxis.x) * invS, (zAxis.x + xAxis.z) * invS, (zAxis.y + yAxis.z) * invS, s * kHalf<T> * kHalf<T> };
+        }
+
         // -------------------------
         // Modifiers
         // -------------------------
 
         void Normalize() noexcept
         {
+            VEC23_COUNT(QuaternionNormalize);
             T lengthSq = LengthSquared();
             if (lengthSq > kSafetyEpsilon<T>)
             {
@@ -88,6 +127,7 @@ namespace Vec23
             }
             else
             {
+                VEC23_COUNT(QuaternionNormalizeDegenerate);
                 *this = Identity();
             }
         }
@@ -101,6 +141,7 @@ namespace Vec23
 
         constexpr void Inverse() noexcept
         {
+            VEC23_COUNT(QuaternionInverse);
             T lengthSq = LengthSquared();
             if (lengthSq > kSafetyEpsilon<T>)
             {
@@ -112,6 +153,7 @@ namespace Vec23
             }
             else
             {
+                VEC23_COUNT(QuaternionInverseDegenerate);
                 *this = Identity();
             }
         }
@@ -176,17 +218,20 @@ namespace Vec23
 
         Vector3<T> ToEuler() const noexcept
         {
+            VEC23_COUNT(QuaternionToEuler);
             Vector3<T> euler;
 
             T gimbalTest = w * y - x * z;
             if (gimbalTest > kHalf<T> - kToleranceEpsilon<T>)
             {
+                VEC23_COUNT(QuaternionToEulerGimbalNorth);
                 euler.x = kZero<T>;
                 euler.y = kPi<T> * kHalf<T>;
                 euler.z = kTwo<T> * std::atan2(z, w);
             }
             else if (gimbalTest < kToleranceEpsilon<T> - kHalf<T>)
             {
+                VEC23_COUNT(QuaternionToEulerGimbalSouth);
                 euler.x = kZero<T>;
                 euler.y = -kPi<T> * kHalf<T>;
                 euler.z = kTwo<T> * std::atan2(x, w);
@@ -240,7 +285,7 @@ namespace Vec23
 
         std::string ToString() const
         {
-            return std::format("({}, {}, {}, {})", w, x, y, z);
+            return std::format("{}", *this);
         }
 
         // -------------------------
@@ -267,6 +312,7 @@ namespace Vec23
 
         static Quaternion Slerp(const Quaternion& a, const Quaternion& b, T t) noexcept
         {
+            VEC23_COUNT(QuaternionSlerp);
             t = std::clamp(t, kZero<T>, kOne<T>);
 
             T dot = a.Dot(b);
@@ -279,6 +325,7 @@ namespace Vec23
 
             if (dot > kOne<T> - kToleranceEpsilon<T>)
             {
+                VEC23_COUNT(QuaternionSlerpLerpFallback);
                 return Lerp(a, target, t);
             }
 
@@ -367,7 +414,173 @@ namespace Vec23
         }
     };
 
+    // Quaternion that is normalized on construction. Its inverse is the conjugate, and APIs taking it
+    // skip the length checks.
+    template<std::floating_point T>
+    class UnitQuaternion
+    {
+    public:
+        constexpr UnitQuaternion() noexcept = default;
+
+        // Degenerate input falls back to the identity.
+        explicit UnitQuaternion(const Quaternion<T>& q) noexcept : m_value(q.GetNormalized()) {}
+
+        static UnitQuaternion FromNormalized(const Quaternion<T>& q) noexcept
+        {
+            assert(q.IsNormalized());
+            return UnitQuaternion(q, Trusted());
+        }
+
+        static constexpr UnitQuaternion Identity() noexcept
+        {
+            return UnitQuaternion();
+        }
+
+        static UnitQuaternion FromAxisAngle(const UnitVector3<T>& axis, T degrees) noexcept
+        {
+            return UnitQuaternion(Quaternion<T>::FromAxisAngle(axis, degrees), Trusted());
+        }
+
+        static UnitQuaternion FromEuler(T rollDegrees, T pitchDegrees, T yawDegrees) noexcept
+        {
+            return UnitQuaternion(Quaternion<T>::FromEuler(rollDegrees, pitchDegrees, yawDegrees), Trusted());
+        }
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        // Removes the drift accumulated by long chains of products.
+        void Renormalize() noexcept
+        {
+            m_value.Normalize();
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr const Quaternion<T>& Get() const noexcept
+        {
+            return m_value;
+        }
+
+        constexpr operator const Quaternion<T>&() const noexcept
+        {
+            return m_value;
+        }
+
+        constexpr T Dot(const UnitQuaternion& other) const noexcept
+        {
+            return m_value.Dot(other.m_value);
+        }
+
+        constexpr UnitQuaternion GetInversed() const noexcept
+        {
+            return UnitQuaternion(m_value.GetConjugated(), Trusted());
+        }
+
+        constexpr Vector3<T> RotateVector(const Vector3<T>& v) const noexcept
+        {
+            return m_value.RotateVector(v);
+        }
+
+        constexpr UnitVector3<T> RotateVector(const UnitVector3<T>& v) const noexcept
+        {
+            return UnitVector3<T>(m_value.RotateVector(v.Get()), typename UnitVector3<T>::Trusted());
+        }
+
+        Vector3<T> ToEuler() const noexcept
+        {
+            return m_value.ToEuler();
+        }
+
+        void ToAxisAngle(Vector3<T>& outAxis, T& outDegrees) const noexcept
+        {
+            m_value.ToAxisAngle(outAxis, outDegrees);
+        }
+
+        bool IsNearlyEqual(const UnitQuaternion& other, T epsilon = kSafetyEpsilon<T>) const noexcept
+        {
+            T dot = Dot(other);
+            return std::abs(dot * dot - kOne<T>) <= epsilon;
+        }
+
+        std::string ToString() const
+        {
+            return m_value.ToString();
+        }
+
+        // -------------------------
+        // Utilities
+        // -------------------------
+
+        static UnitQuaternion Slerp(const UnitQuaternion& a, const UnitQuaternion& b, T t) noexcept
+        {
+            return UnitQuaternion(Quaternion<T>::Slerp(a.m_value, b.m_value, t), Trusted());
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const UnitQuaternion& other) const noexcept = default;
+
+        constexpr UnitQuaternion operator*(const UnitQuaternion& other) const noexcept
+        {
+            return UnitQuaternion(m_value * other.m_value, Trusted());
+        }
+
+        constexpr Vector3<T> operator*(const Vector3<T>& v) const noexcept
+        {
+            return m_value.RotateVector(v);
+        }
+
+        constexpr UnitQuaternion operator-() const noexcept
+        {
+            return UnitQuaternion(-m_value, Trusted());
+        }
+
+    private:
+        struct Trusted {};
+
+        Quaternion<T> m_value;
+
+        constexpr UnitQuaternion(const Quaternion<T>& q, Trusted) noexcept : m_value(q) {}
+    };
+
     using FQuaternion = Quaternion<float>;
     using DQuaternion = Quaternion<double>;
     using LDQuaternion = Quaternion<long double>;
+
+    using FUnitQuaternion = UnitQuaternion<float>;
+    using DUnitQuaternion = UnitQuaternion<double>;
+    using LDUnitQuaternion = UnitQuaternion<long double>;
 }
+
+template<std::floating_point T>
+struct std::formatter<Vec23::Quaternion<T>> : std::formatter<T>
+{
+    template<typename FormatContext>
+    auto format(const Vec23::Quaternion<T>& q, FormatContext& ctx) const
+    {
+        auto out = ctx.out();
+        *out++ = '(';
+        ctx.advance_to(out);
+        out = std::formatter<T>::format(q.w, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<T>::format(q.x, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<T>::format(q.y, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<T>::format(q.z, ctx);
+        *out++ = ')';
+        return out;
+    }
+};
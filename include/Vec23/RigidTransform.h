@@ -0,0 +1,271 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <vector>
+#include "Constants.h"
+#include "Parallel.h"
+#include "PointCloud.h"
+#include "Quaternion.h"
+#include "StridedView.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    namespace Detail
+    {
+        template<std::floating_point T>
+        class PointTree
+        {
+        public:
+            explicit PointTree(std::span<const Vector3<T>> points) : m_points(points.begin(), points.end())
+            {
+                Build(0, m_points.size(), 0);
+            }
+
+            const Vector3<T>& Nearest(const Vector3<T>& query) const noexcept
+            {
+                assert(!m_points.empty());
+
+                std::size_t best = 0;
+                T bestDistanceSq = std::numeric_limits<T>::infinity();
+                Search(query, 0, m_points.size(), 0, best, bestDistanceSq);
+                return m_points[best];
+            }
+
+        private:
+            std::vector<Vector3<T>> m_points;
+
+            void Build(std::size_t begin, std::size_t end, int axis)
+            {
+                if (end - begin <= 1)
+                {
+                    return;
+                }
+
+                std::size_t mid = begin + (end - begin) / 2;
+                std::nth_element(m_points.begin() + begin, m_points.begin() + mid, m_points.begin() + end,
+                    [axis](const Vector3<T>& a, const Vector3<T>& b) { return a[axis] < b[axis]; });
+
+                Build(begin, mid, (axis + 1) % 3);
+                Build(mid + 1, end, (axis + 1) % 3);
+            }
+
+            void Search(const Vector3<T>& query, std::size_t begin, std::size_t end, int axis,
+                std::size_t& best, T& bestDistanceSq) const noexcept
+            {
+                if (begin >= end)
+                {
+                    return;
+                }
+
+                std::size_t mid = begin + (end - begin) / 2;
+                T distanceSq = Vector3<T>::DistanceSquared(query, m_points[mid]);
+                if (distanceSq < bestDistanceSq)
+                {
+                    bestDistanceSq = distanceSq;
+                    best = mid;
+                }
+
+                T delta = query[axis] - m_points[mid][axis];
+                int nextAxis = (axis + 1) % 3;
+                if (delta < kZero<T>)
+                {
+                    Search(query, begin, mid, nextAxis, best, bestDistanceSq);
+                    if (delta * delta < bestDistanceSq)
+                    {
+                        Search(query, mid + 1, end, nextAxis, best, bestDistanceSq);
+                    }
+                }
+                else
+                {
+                    Search(query, mid + 1, end, nextAxis, best, bestDistanceSq);
+                    if (delta * delta < bestDistanceSq)
+                    {
+                        Search(query, begin, mid, nextAxis, best, bestDistanceSq);
+                    }
+                }
+            }
+        };
+    }
+
+    template<std::floating_point T>
+    struct RigidTransform
+    {
+        Quaternion<T> rotation;
+        Vector3<T> translation;
+
+        constexpr RigidTransform() noexcept = default;
+
+        constexpr RigidTransform(const Quaternion<T>& rotation, const Vector3<T>& translation) noexcept
+            : rotation(rotation), translation(translation) {}
+
+        static RigidTransform FromCorrespondences(std::span<const Vector3<T>> source, std::span<const Vector3<T>> target)
+        {
+            assert(source.size() == target.size());
+
+            if (source.empty())
+            {
+                return {};
+            }
+
+            Vector3<T> sourceCentroid = PointCloud<T>::Centroid(source);
+            Vector3<T> targetCentroid = PointCloud<T>::Centroid(target);
+
+            using Sum = Detail::CompensatedSum<T, 9>;
+            Sum sum = Detail::ParallelReduce(source.size(), Sum{}, [&](std::size_t begin, std::size_t end)
+            {
+                Sum partial;
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    Vector3<T> a = source[i] - sourceCentroid;
+                    Vector3<T> b = target[i] - targetCentroid;
+                    partial.Add(0, a.x * b.x);
+                    partial.Add(1, a.x * b.y);
+                    partial.Add(2, a.x * b.z);
+                    partial.Add(3, a.y * b.x);
+                    partial.Add(4, a.y * b.y);
+                    partial.Add(5, a.y * b.z);
+                    partial.Add(6, a.z * b.x);
+                    partial.Add(7, a.z * b.y);
+                    partial.Add(8, a.z * b.z);
+                }
+                return partial;
+            }, Sum::Combine);
+
+            T sxx = sum.Get(0);
+            T sxy = sum.Get(1);
+            T sxz = sum.Get(2);
+            T syx = sum.Get(3);
+            T syy = sum.Get(4);
+            T syz = sum.Get(5);
+            T szx = sum.Get(6);
+            T szy = sum.Get(7);
+            T szz = sum.Get(8);
+
+            T n[4][4] =
+            {
+                { sxx + syy + szz, syz - szy, szx - sxz, sxy - syx },
+                { syz - szy, sxx - syy - szz, sxy + syx, szx + sxz },
+                { szx - sxz, sxy + syx, syy - sxx - szz, syz + szy },
+                { sxy - syx, szx + sxz, syz + szy, szz - sxx - syy }
+            };
+            T v[4][4];
+            Detail::SymmetricEigen(n, v);
+
+            int largest = 0;
+            for (int i = 1; i < 4; ++i)
+            {
+                if (n[i][i] > n[largest][largest])
+                {
+                    largest = i;
+                }
+            }
+
+            Quaternion<T> rotation(v[0][largest], v[1][largest], v[2][largest], v[3][largest]);
+            rotation.Normalize();
+            return { rotation, targetCentroid - rotation.RotateVector(sourceCentroid) };
+        }
+
+        static RigidTransform IterativeClosestPoint(std::span<const Vector3<T>> source, std::span<const Vector3<T>> target,
+            int maxIterations = 32, T tolerance = kToleranceEpsilon<T>, const RigidTransform& initial = {})
+        {
+            if (source.empty() || target.empty())
+            {
+                return initial;
+            }
+
+            Detail::PointTree<T> tree(target);
+            std::vector<Vector3<T>> matches(source.size());
+            RigidTransform current = initial;
+            T previousError = std::numeric_limits<T>::infinity();
+
+            for (int iteration = 0; iteration < maxIterations; ++iteration)
+            {
+                T error = Detail::ParallelReduce(source.size(), kZero<T>, [&](std::size_t begin, std::size_t end)
+                {
+                    T partial = kZero<T>;
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        Vector3<T> moved = current.TransformPoint(source[i]);
+                        matches[i] = tree.Nearest(moved);
+                        partial += Vector3<T>::DistanceSquared(moved, matches[i]);
+                    }
+                    return partial;
+                }, [](T a, T b) { return a + b; }) / static_cast<T>(source.size());
+
+                if (std::abs(previousError - error) < tolerance)
+                {
+                    break;
+                }
+
+                previousError = error;
+                current = FromCorrespondences(source, matches);
+            }
+
+            return current;
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr Vector3<T> TransformPoint(const Vector3<T>& v) const noexcept
+        {
+            return rotation.RotateVector(v) + translation;
+        }
+
+        void TransformPoints(std::span<Vector3<T>> points) const
+        {
+            TransformPointsOf(points);
+        }
+
+        void TransformPoints(Vector3View<T> points) const
+        {
+            TransformPointsOf(points);
+        }
+
+        RigidTransform GetInversed() const noexcept
+        {
+            Quaternion<T> inverse = rotation.GetInversed();
+            return { inverse, -inverse.RotateVector(translation) };
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr RigidTransform operator*(const RigidTransform& other) const noexcept
+        {
+            return { rotation * other.rotation, rotation.RotateVector(other.translation) + translation };
+        }
+
+        constexpr Vector3<T> operator*(const Vector3<T>& v) const noexcept
+        {
+            return TransformPoint(v);
+        }
+
+    private:
+        template<typename Points>
+        void TransformPointsOf(const Points& points) const
+        {
+            Detail::ParallelFor(points.size(), [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    points[i] = TransformPoint(points[i]);
+                }
+            });
+        }
+    };
+
+    using FRigidTransform = RigidTransform<float>;
+    using DRigidTransform = RigidTransform<double>;
+    using LDRigidTransform = RigidTransform<long double>;
+}
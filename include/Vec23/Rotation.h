@@ -0,0 +1,228 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include "Constants.h"
+#include "Parallel.h"
+#include "Quaternion.h"
+#include "StridedView.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    // 2D rotation with its cosine and sine evaluated once, for rotating many vectors by the same angle.
+    template<std::floating_point T>
+    class Rotation2
+    {
+    public:
+        constexpr Rotation2() noexcept = default;
+
+        explicit Rotation2(T degrees) noexcept
+        {
+            T radians = degrees * kDegreesToRadians<T>;
+            m_cos = std::cos(radians);
+            m_sin = std::sin(radians);
+        }
+
+        static constexpr Rotation2 Identity() noexcept
+        {
+            return Rotation2();
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr T Cos() const noexcept
+        {
+            return m_cos;
+        }
+
+        constexpr T Sin() const noexcept
+        {
+            return m_sin;
+        }
+
+        T Degrees() const noexcept
+        {
+            return std::atan2(m_sin, m_cos) * kRadiansToDegrees<T>;
+        }
+
+        constexpr Vector2<T> Apply(const Vector2<T>& v) const noexcept
+        {
+            return { (v.x * m_cos) - (v.y * m_sin), (v.x * m_sin) + (v.y * m_cos) };
+        }
+
+        void Apply(std::span<Vector2<T>> points) const
+        {
+            ApplyOf(points, points);
+        }
+
+        void Apply(Vector2View<T> points) const
+        {
+            ApplyOf(points, points);
+        }
+
+        void Apply(std::span<const Vector2<T>> points, std::span<Vector2<T>> outPoints) const
+        {
+            assert(outPoints.size() >= points.size());
+            ApplyOf(points, outPoints);
+        }
+
+        constexpr Rotation2 GetInversed() const noexcept
+        {
+            return Rotation2(m_cos, -m_sin);
+        }
+
+        bool IsNearlyEqual(const Rotation2& other, T epsilon = kToleranceEpsilon<T>) const noexcept
+        {
+            return std::abs(m_cos - other.m_cos) <= epsilon && std::abs(m_sin - other.m_sin) <= epsilon;
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const Rotation2& other) const noexcept = default;
+
+        constexpr Rotation2 operator*(const Rotation2& other) const noexcept
+        {
+            return Rotation2((m_cos * other.m_cos) - (m_sin * other.m_sin), (m_sin * other.m_cos) + (m_cos * other.m_sin));
+        }
+
+        constexpr Vector2<T> operator*(const Vector2<T>& v) const noexcept
+        {
+            return Apply(v);
+        }
+
+    private:
+        T m_cos = kOne<T>;
+        T m_sin = kZero<T>;
+
+        constexpr Rotation2(T cosT, T sinT) noexcept : m_cos(cosT), m_sin(sinT) {}
+
+        template<typename Input, typename Output>
+        void ApplyOf(const Input& points, const Output& outPoints) const
+        {
+            Detail::ParallelFor(points.size(), [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    outPoints[i] = Apply(points[i]);
+                }
+            });
+        }
+    };
+
+    // Rotation about a fixed axis with the axis normalized and the cosine and sine evaluated once.
+    // Produces the same result as Vector3::Rotate without repeating that work per vector.
+    template<std::floating_point T>
+    class AxisRotation3
+    {
+    public:
+        constexpr AxisRotation3() noexcept = default;
+
+        AxisRotation3(T degrees, const UnitVector3<T>& axis) noexcept : m_axis(axis)
+        {
+            T radians = degrees * kDegreesToRadians<T>;
+            m_cos = std::cos(radians);
+            m_sin = std::sin(radians);
+        }
+
+        // Degenerate axes fall back to the X axis.
+        AxisRotation3(T degrees, const Vector3<T>& axis) noexcept : AxisRotation3(degrees, UnitVector3<T>(axis)) {}
+
+        static constexpr AxisRotation3 Identity() noexcept
+        {
+            return AxisRotation3();
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr const UnitVector3<T>& Axis() const noexcept
+        {
+            return m_axis;
+        }
+
+        T Degrees() const noexcept
+        {
+            return std::atan2(m_sin, m_cos) * kRadiansToDegrees<T>;
+        }
+
+        constexpr Vector3<T> Apply(const Vector3<T>& v) const noexcept
+        {
+            const Vector3<T>& u = m_axis.Get();
+            return (v * m_cos) + (u.Cross(v) * m_sin) + (u * u.Dot(v) * (kOne<T> - m_cos));
+        }
+
+        void Apply(std::span<Vector3<T>> points) const
+        {
+            ApplyOf(points, points);
+        }
+
+        void Apply(Vector3View<T> points) const
+        {
+            ApplyOf(points, points);
+        }
+
+        void Apply(std::span<const Vector3<T>> points, std::span<Vector3<T>> outPoints) const
+        {
+            assert(outPoints.size() >= points.size());
+            ApplyOf(points, outPoints);
+        }
+
+        constexpr AxisRotation3 GetInversed() const noexcept
+        {
+            return AxisRotation3(m_axis, m_cos, -m_sin);
+        }
+
+        Quaternion<T> ToQuaternion() const noexcept
+        {
+            return Quaternion<T>::FromAxisAngle(m_axis, Degrees());
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr Vector3<T> operator*(const Vector3<T>& v) const noexcept
+        {
+            return Apply(v);
+        }
+
+    private:
+        UnitVector3<T> m_axis;
+        T m_cos = kOne<T>;
+        T m_sin = kZero<T>;
+
+        constexpr AxisRotation3(const UnitVector3<T>& axis, T cosT, T sinT) noexcept : m_axis(axis), m_cos(cosT), m_sin(sinT) {}
+
+        template<typename Input, typename Output>
+        void ApplyOf(const Input& points, const Output& outPoints) const
+        {
+            Detail::ParallelFor(points.size(), [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    outPoints[i] = Apply(points[i]);
+                }
+            });
+        }
+    };
+
+    using FRotation2 = Rotation2<float>;
+    using DRotation2 = Rotation2<double>;
+    using LDRotation2 = Rotation2<long double>;
+
+    using FAxisRotation3 = AxisRotation3<float>;
+    using DAxisRotation3 = AxisRotation3<double>;
+    using LDAxisRotation3 = AxisRotation3<long double>;
+}
@@ -0,0 +1,131 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "Quaternion.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    namespace Detail
+    {
+        inline constexpr std::size_t kCacheLineSize = 64;
+    }
+
+    // Single-producer, single-consumer triple buffer of element arrays. The producer fills its back buffer
+    // and publishes it by swapping its index into the shared middle slot; the consumer swaps the middle slot
+    // with its front buffer whenever a newer frame is waiting. Neither side ever waits for the other and the
+    // elements are plain data: the middle index is the only atomic. Give each consumer thread its own store.
+    template<typename Element>
+        requires std::is_trivially_copyable_v<Element>
+    class SnapshotStore
+    {
+    public:
+        SnapshotStore() = default;
+
+        explicit SnapshotStore(std::size_t size)
+        {
+            for (Buffer& buffer : m_buffers)
+            {
+                buffer.items.resize(size);
+            }
+        }
+
+        SnapshotStore(const SnapshotStore&) = delete;
+        SnapshotStore& operator=(const SnapshotStore&) = delete;
+
+        // -------------------------
+        // Producer
+        // -------------------------
+
+        // The back buffer holds whatever frame it last carried, not the latest one, so fill it completely.
+        std::span<Element> Write() noexcept
+        {
+            return m_buffers[m_back].items;
+        }
+
+        void Resize(std::size_t size)
+        {
+            m_buffers[m_back].items.resize(size);
+        }
+
+        void Publish() noexcept
+        {
+            m_buffers[m_back].frame = ++m_published;
+            m_back = m_middle.exchange(m_back | kFresh, std::memory_order_acq_rel) & kIndexMask;
+        }
+
+        void Publish(std::span<const Element> items)
+        {
+            m_buffers[m_back].items.assign(items.begin(), items.end());
+            Publish();
+        }
+
+        // -------------------------
+        // Consumer
+        // -------------------------
+
+        // Moves to the newest published frame, if there is one the consumer has not seen yet.
+        bool Refresh() noexcept
+        {
+            if ((m_middle.load(std::memory_order_relaxed) & kFresh) == 0)
+            {
+                return false;
+            }
+
+            m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & kIndexMask;
+            return true;
+        }
+
+        std::span<const Element> Read() const noexcept
+        {
+            return m_buffers[m_front].items;
+        }
+
+        // Number of the frame Read() returns, counting from 1; 0 until the first Refresh() succeeds.
+        std::uint64_t FrameNumber() const noexcept
+        {
+            return m_buffers[m_front].frame;
+        }
+
+    private:
+        static constexpr std::uint8_t kIndexMask = 0x3;
+        static constexpr std::uint8_t kFresh = 0x4;
+
+        struct Buffer
+        {
+            std::vector<Element> items;
+            std::uint64_t frame = 0;
+        };
+
+        std::array<Buffer, 3> m_buffers;
+
+        // Producer, shared and consumer state each sit on their own cache line.
+        alignas(Detail::kCacheLineSize) std::uint8_t m_back = 0;
+        std::uint64_t m_published = 0;
+        alignas(Detail::kCacheLineSize) std::atomic<std::uint8_t> m_middle = 1;
+        alignas(Detail::kCacheLineSize) std::uint8_t m_front = 2;
+    };
+
+    template<std::floating_point T>
+    using Vector3Store = SnapshotStore<Vector3<T>>;
+
+    template<std::floating_point T>
+    using QuaternionStore = SnapshotStore<Quaternion<T>>;
+
+    using FVector3Store = Vector3Store<float>;
+    using DVector3Store = Vector3Store<double>;
+    using LDVector3Store = Vector3Store<long double>;
+
+    using FQuaternionStore = QuaternionStore<float>;
+    using DQuaternionStore = QuaternionStore<double>;
+    using LDQuaternionStore = QuaternionStore<long double>;
+}
@@ -0,0 +1,410 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+#include "BatchMath.h"
+#include "Constants.h"
+#include "Expression.h"
+#include "Instrumentation.h"
+#include "Parallel.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    template<std::floating_point T>
+    struct Vector3SoA : Vector3ExpressionOperators<Vector3SoA<T>, T>
+    {
+        std::pmr::vector<T> x;
+        std::pmr::vector<T> y;
+        std::pmr::vector<T> z;
+
+        Vector3SoA() = default;
+
+        // Columns and batch scratch buffers are allocated from resource, e.g. a FrameArena.
+        explicit Vector3SoA(std::pmr::memory_resource* resource) : x(resource), y(resource), z(resource) {}
+
+        explicit Vector3SoA(std::size_t size, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : x(size, resource), y(size, resource), z(size, resource) {}
+
+        explicit Vector3SoA(std::span<const Vector3<T>> items,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : Vector3SoA(items.size(), resource)
+        {
+            for (std::size_t i = 0; i < items.size(); ++i)
+            {
+                Set(i, items[i]);
+            }
+        }
+
+        template<Vector3Expression E>
+        Vector3SoA(const E& expression, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : Vector3SoA(resource)
+        {
+            Assign(expression);
+        }
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        void Resize(std::size_t size)
+        {
+            x.resize(size);
+            y.resize(size);
+            z.resize(size);
+        }
+
+        void Reserve(std::size_t capacity)
+        {
+            x.reserve(capacity);
+            y.reserve(capacity);
+            z.reserve(capacity);
+        }
+
+        void Clear() noexcept
+        {
+            x.clear();
+            y.clear();
+            z.clear();
+        }
+
+        void PushBack(const Vector3<T>& v)
+        {
+            x.push_back(v.x);
+            y.push_back(v.y);
+            z.push_back(v.z);
+        }
+
+        void Set(std::size_t index, const Vector3<T>& v) noexcept
+        {
+            assert(index < Size());
+            x[index] = v.x;
+            y[index] = v.y;
+            z[index] = v.z;
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        std::size_t Size() const noexcept
+        {
+            return x.size();
+        }
+
+        bool IsEmpty() const noexcept
+        {
+            return x.empty();
+        }
+
+        std::pmr::memory_resource* Resource() const noexcept
+        {
+            return x.get_allocator().resource();
+        }
+
+        Vector3<T> Get(std::size_t index) const noexcept
+        {
+            assert(index < Size());
+            return { x[index], y[index], z[index] };
+        }
+
+        std::vector<Vector3<T>> ToAoS() const
+        {
+            std::vector<Vector3<T>> result(Size());
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                result[i] = Get(i);
+            }
+            return result;
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        // Evaluates the whole expression tree per element in one pass, with no intermediate containers.
+        // Every node reads only its own index, so this container may also appear in the expression.
+        template<Vector3Expression E>
+        Vector3SoA& operator=(const E& expression)
+        {
+            Assign(expression);
+            return *this;
+        }
+
+    private:
+        template<Vector3Expression E>
+        void Assign(const E& expression)
+        {
+            Resize(expression.Size());
+
+            T* outX = x.data();
+            T* outY = y.data();
+            T* outZ = z.data();
+
+            Detail::ParallelFor(Size(), [&expression, outX, outY, outZ](std::size_t begin, std::size_t end)
+            {
+                // Staging each tile locally leaves the compiler no aliasing between the operand columns and
+                // the outputs to check for, which would otherwise keep wide expressions from vectorizing.
+                constexpr std::size_t kTile = Detail::kBatchTile;
+                T tileX[kTile], tileY[kTile], tileZ[kTile];
+
+                for (std::size_t first = begin; first < end; first += kTile)
+                {
+                    std::size_t count = std::min(kTile, end - first);
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        Vector3<T> v = expression.Get(first + i);
+                        tileX[i] = v.x;
+                        tileY[i] = v.y;
+                        tileZ[i] = v.z;
+                    }
+                    std::copy_n(tileX, count, outX + first);
+                    std::copy_n(tileY, count, outY + first);
+                    std::copy_n(tileZ, count, outZ + first);
+                }
+            }, Resource());
+        }
+    };
+
+    template<std::floating_point T>
+    struct QuaternionSoA
+    {
+        std::pmr::vector<T> w;
+        std::pmr::vector<T> x;
+        std::pmr::vector<T> y;
+        std::pmr::vector<T> z;
+
+        QuaternionSoA() = default;
+
+        explicit QuaternionSoA(std::pmr::memory_resource* resource) : w(resource), x(resource), y(resource), z(resource) {}
+
+        explicit QuaternionSoA(std::size_t size, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : w(size, resource), x(size, resource), y(size, resource), z(size, resource) {}
+
+        explicit QuaternionSoA(std::span<const Quaternion<T>> items,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : QuaternionSoA(items.size(), resource)
+        {
+            for (std::size_t i = 0; i < items.size(); ++i)
+            {
+                Set(i, items[i]);
+            }
+        }
+
+        // Batch Quaternion::FromEuler over roll (x), pitch (y) and yaw (z) columns in degrees.
+        static void FromEuler(const Vector3SoA<T>& eulerDegrees, QuaternionSoA& out)
+        {
+            out.Resize(eulerDegrees.Size());
+
+            const T* roll = eulerDegrees.x.data();
+            const T* pitch = eulerDegrees.y.data();
+            const T* yaw = eulerDegrees.z.data();
+            T* outW = out.w.data();
+            T* outX = out.x.data();
+            T* outY = out.y.data();
+            T* outZ = out.z.data();
+
+            Detail::ParallelFor(out.Size(), [=](std::size_t begin, std::size_t end)
+            {
+                // Staging through tile-local arrays keeps each loop down to a few unrelated pointers,
+                // so the vectorizer needs no runtime alias checks.
+                constexpr std::size_t kTile = Detail::kBatchTile;
+                T sinRoll[kTile], cosRoll[kTile], sinPitch[kTile], cosPitch[kTile], sinYaw[kTile], cosYaw[kTile];
+
+                for (std::size_t first = begin; first < end; first += kTile)
+                {
+                    std::size_t count = std::min(kTile, end - first);
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        Detail::BatchSinCos(roll[first + i] * kHalf<T>, sinRoll[i], cosRoll[i]);
+                    }
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        Detail::BatchSinCos(pitch[first + i] * kHalf<T>, sinPitch[i], cosPitch[i]);
+                    }
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        Detail::BatchSinCos(yaw[first + i] * kHalf<T>, sinYaw[i], cosYaw[i]);
+                    }
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        outW[first + i] = cosRoll[i] * cosPitch[i] * cosYaw[i] + sinRoll[i] * sinPitch[i] * sinYaw[i];
+                        outX[first + i] = sinRoll[i] * cosPitch[i] * cosYaw[i] - cosRoll[i] * sinPitch[i] * sinYaw[i];
+                        outY[first + i] = cosRoll[i] * sinPitch[i] * cosYaw[i] + sinRoll[i] * cosPitch[i] * sinYaw[i];
+                        outZ[first + i] = cosRoll[i] * cosPitch[i] * sinYaw[i] - sinRoll[i] * sinPitch[i] * cosYaw[i];
+                    }
+                }
+            }, out.Resource());
+        }
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        void Resize(std::size_t size)
+        {
+            w.resize(size);
+            x.resize(size);
+            y.resize(size);
+            z.resize(size);
+        }
+
+        void Reserve(std::size_t capacity)
+        {
+            w.reserve(capacity);
+            x.reserve(capacity);
+            y.reserve(capacity);
+            z.reserve(capacity);
+        }
+
+        void Clear() noexcept
+        {
+            w.clear();
+            x.clear();
+            y.clear();
+            z.clear();
+        }
+
+        void PushBack(const Quaternion<T>& q)
+        {
+            w.push_back(q.w);
+            x.push_back(q.x);
+            y.push_back(q.y);
+            z.push_back(q.z);
+        }
+
+        void Set(std::size_t index, const Quaternion<T>& q) noexcept
+        {
+            assert(index < Size());
+            w[index] = q.w;
+            x[index] = q.x;
+            y[index] = q.y;
+            z[index] = q.z;
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        std::size_t Size() const noexcept
+        {
+            return w.size();
+        }
+
+        bool IsEmpty() const noexcept
+        {
+            return w.empty();
+        }
+
+        std::pmr::memory_resource* Resource() const noexcept
+        {
+            return w.get_allocator().resource();
+        }
+
+        Quaternion<T> Get(std::size_t index) const noexcept
+        {
+            assert(index < Size());
+            return { w[index], x[index], y[index], z[index] };
+        }
+
+        std::vector<Quaternion<T>> ToAoS() const
+        {
+            std::vector<Quaternion<T>> result(Size());
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                result[i] = Get(i);
+            }
+            return result;
+        }
+
+        // Batch Quaternion::ToEuler. Both gimbal-lock cases are folded into selects on the atan2 inputs,
+        // so every element runs the same instructions.
+        void ToEuler(Vector3SoA<T>& outEulerDegrees) const
+        {
+            VEC23_COUNT_N(QuaternionToEuler, Size());
+            outEulerDegrees.Resize(Size());
+
+            const T* inW = w.data();
+            const T* inX = x.data();
+            const T* inY = y.data();
+            const T* inZ = z.data();
+            T* roll = outEulerDegrees.x.data();
+            T* pitch = outEulerDegrees.y.data();
+            T* yaw = outEulerDegrees.z.data();
+
+            Detail::ParallelFor(Size(), [=](std::size_t begin, std::size_t end)
+            {
+                constexpr std::size_t kTile = Detail::kBatchTile;
+                T rollY[kTile], rollX[kTile], pitchSin[kTile], yawY[kTile], yawX[kTile], lockedPitch[kTile], locked[kTile];
+                std::size_t lockedUp = 0;
+                std::size_t lockedDown = 0;
+
+                for (std::size_t first = begin; first < end; first += kTile)
+                {
+                    std::size_t count = std::min(kTile, end - first);
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        T qw = inW[first + i];
+                        T qx = inX[first + i];
+                        T qy = inY[first + i];
+                        T qz = inZ[first + i];
+
+                        T gimbalTest = qw * qy - qx * qz;
+                        bool up = gimbalTest > kHalf<T> - kToleranceEpsilon<T>;
+                        bool down = gimbalTest < kToleranceEpsilon<T> - kHalf<T>;
+
+                        T wSq = qw * qw;
+                        T xSq = qx * qx;
+                        T ySq = qy * qy;
+                        T zSq = qz * qz;
+
+                        rollY[i] = kTwo<T> * (qw * qx + qy * qz);
+                        rollX[i] = wSq - xSq - ySq + zSq;
+                        pitchSin[i] = -kTwo<T> * (qx * qz - qw * qy);
+                        yawY[i] = up ? qz : (down ? qx : kTwo<T> * (qx * qy + qw * qz));
+                        yawX[i] = (up || down) ? qw : wSq + xSq - ySq - zSq;
+                        lockedPitch[i] = up ? kPi<T> * kHalf<T> : -kPi<T> * kHalf<T>;
+                        locked[i] = (up || down) ? kOne<T> : kZero<T>;
+                        lockedUp += up;
+                        lockedDown += down;
+                    }
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        T angle = Detail::BatchAtan2(rollY[i], rollX[i]);
+                        roll[first + i] = (locked[i] > kZero<T>) ? kZero<T> : angle * kRadiansToDegrees<T>;
+                    }
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        T angle = (locked[i] > kZero<T>) ? lockedPitch[i] : Detail::BatchAsin(pitchSin[i]);
+                        pitch[first + i] = angle * kRadiansToDegrees<T>;
+                    }
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        // Locked rows fold the angle into yaw as 2 * atan2, hence the scale of 1 + locked.
+                        yaw[first + i] = Detail::BatchAtan2(yawY[i], yawX[i]) * (kOne<T> + locked[i]) * kRadiansToDegrees<T>;
+                    }
+                }
+
+                // Tallied in registers above so the tile loop stays branch-free; one add per chunk.
+                VEC23_COUNT_N(QuaternionToEulerGimbalNorth, lockedUp);
+                VEC23_COUNT_N(QuaternionToEulerGimbalSouth, lockedDown);
+            }, outEulerDegrees.Resource());
+        }
+    };
+
+    using FVector3SoA = Vector3SoA<float>;
+    using DVector3SoA = Vector3SoA<double>;
+    using LDVector3SoA = Vector3SoA<long double>;
+
+    using FQuaternionSoA = QuaternionSoA<float>;
+    using DQuaternionSoA = QuaternionSoA<double>;
+    using LDQuaternionSoA = QuaternionSoA<long double>;
+}
@@ -0,0 +1,236 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include "Quaternion.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    // Non-owning view of items that sit at a fixed byte stride inside a foreign buffer, e.g. the position
+    // member of an interleaved vertex struct. Items are accessed in place, without copying.
+    template<typename Item>
+    class StridedView
+    {
+        using Byte = std::conditional_t<std::is_const_v<Item>, const std::byte, std::byte>;
+        using Address = std::conditional_t<std::is_const_v<Item>, const void*, void*>;
+
+    public:
+        using element_type = Item;
+        using value_type = std::remove_cv_t<Item>;
+
+        class Iterator
+        {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_cv_t<Item>;
+            using difference_type = std::ptrdiff_t;
+            using reference = Item&;
+
+            constexpr Iterator() noexcept = default;
+
+            constexpr Iterator(Byte* pointer, std::ptrdiff_t stride) noexcept : m_pointer(pointer), m_stride(stride) {}
+
+            Item& operator*() const noexcept
+            {
+                return *reinterpret_cast<Item*>(m_pointer);
+            }
+
+            Item* operator->() const noexcept
+            {
+                return reinterpret_cast<Item*>(m_pointer);
+            }
+
+            Item& operator[](difference_type n) const noexcept
+            {
+                return *reinterpret_cast<Item*>(m_pointer + n * m_stride);
+            }
+
+            constexpr Iterator& operator++() noexcept
+            {
+                m_pointer += m_stride;
+                return *this;
+            }
+
+            constexpr Iterator& operator--() noexcept
+            {
+                m_pointer -= m_stride;
+                return *this;
+            }
+
+            constexpr Iterator operator++(int) noexcept
+            {
+                Iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            constexpr Iterator operator--(int) noexcept
+            {
+                Iterator result = *this;
+                --*this;
+                return result;
+            }
+
+            constexpr Iterator& operator+=(difference_type n) noexcept
+            {
+                m_pointer += n * m_stride;
+                return *this;
+            }
+
+            constexpr Iterator& operator-=(difference_type n) noexcept
+            {
+                m_pointer -= n * m_stride;
+                return *this;
+            }
+
+            friend constexpr Iterator operator+(Iterator it, difference_type n) noexcept
+            {
+                return it += n;
+            }
+
+            friend constexpr Iterator operator+(difference_type n, Iterator it) noexcept
+            {
+                return it += n;
+            }
+
+            friend constexpr Iterator operator-(Iterator it, difference_type n) noexcept
+            {
+                return it -= n;
+            }
+
+            friend constexpr difference_type operator-(const Iterator& a, const Iterator& b) noexcept
+            {
+                return (a.m_stride == 0) ? 0 : (a.m_pointer - b.m_pointer) / a.m_stride;
+            }
+
+            friend constexpr bool operator==(const Iterator& a, const Iterator& b) noexcept
+            {
+                return a.m_pointer == b.m_pointer;
+            }
+
+            friend constexpr std::strong_ordering operator<=>(const Iterator& a, const Iterator& b) noexcept
+            {
+                return (a - b) <=> 0;
+            }
+
+        private:
+            Byte* m_pointer = nullptr;
+            std::ptrdiff_t m_stride = 0;
+        };
+
+        constexpr StridedView() noexcept = default;
+
+        StridedView(Address first, std::size_t count, std::size_t stride) noexcept
+            : m_first(static_cast<Byte*>(first)), m_count(count), m_stride(stride)
+        {
+            assert(count == 0 || stride >= sizeof(Item));
+            assert(reinterpret_cast<std::uintptr_t>(first) % alignof(Item) == 0 && stride % alignof(Item) == 0);
+        }
+
+        StridedView(std::span<Item> items) noexcept
+            : StridedView(items.data(), items.size(), sizeof(Item)) {}
+
+        // View of the member at byteOffset inside each element of an interleaved array.
+        template<typename Vertex>
+            requires (std::is_const_v<Item> || !std::is_const_v<Vertex>)
+        StridedView(std::span<Vertex> vertices, std::size_t byteOffset) noexcept
+            : StridedView(reinterpret_cast<Byte*>(vertices.data()) + byteOffset, vertices.size(), sizeof(Vertex))
+        {
+            assert(byteOffset + sizeof(Item) <= sizeof(Vertex));
+        }
+
+        operator StridedView<const Item>() const noexcept
+            requires (!std::is_const_v<Item>)
+        {
+            return { m_first, m_count, m_stride };
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr std::size_t size() const noexcept
+        {
+            return m_count;
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return m_count == 0;
+        }
+
+        constexpr std::size_t Stride() const noexcept
+        {
+            return m_stride;
+        }
+
+        constexpr bool IsContiguous() const noexcept
+        {
+            return m_stride == sizeof(Item);
+        }
+
+        Item& operator[](std::size_t index) const noexcept
+        {
+            assert(index < m_count);
+            return *reinterpret_cast<Item*>(m_first + index * m_stride);
+        }
+
+        Iterator begin() const noexcept
+        {
+            return { m_first, static_cast<std::ptrdiff_t>(m_stride) };
+        }
+
+        Iterator end() const noexcept
+        {
+            return { m_first + m_count * m_stride, static_cast<std::ptrdiff_t>(m_stride) };
+        }
+
+        StridedView Subview(std::size_t offset, std::size_t count) const noexcept
+        {
+            assert(offset + count <= m_count);
+            return { m_first + offset * m_stride, count, m_stride };
+        }
+
+    private:
+        Byte* m_first = nullptr;
+        std::size_t m_count = 0;
+        std::size_t m_stride = sizeof(Item);
+    };
+
+    template<std::floating_point T>
+    using Vector2View = StridedView<Vector2<T>>;
+
+    template<std::floating_point T>
+    using Vector3View = StridedView<Vector3<T>>;
+
+    template<std::floating_point T>
+    using QuaternionView = StridedView<Quaternion<T>>;
+
+    template<std::floating_point T>
+    using ConstVector2View = StridedView<const Vector2<T>>;
+
+    template<std::floating_point T>
+    using ConstVector3View = StridedView<const Vector3<T>>;
+
+    template<std::floating_point T>
+    using ConstQuaternionView = StridedView<const Quaternion<T>>;
+
+    using FVector3View = Vector3View<float>;
+    using DVector3View = Vector3View<double>;
+    using LDVector3View = Vector3View<long double>;
+
+    using FQuaternionView = QuaternionView<float>;
+    using DQuaternionView = QuaternionView<double>;
+    using LDQuaternionView = QuaternionView<long double>;
+}
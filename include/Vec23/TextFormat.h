@@ -0,0 +1,306 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+#include "MappedFile.h"
+#include "Parallel.h"
+#include "Quaternion.h"
+#include "SoA.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    enum class TextDialect : std::uint8_t
+    {
+        XYZ,
+        OBJ
+    };
+
+    namespace Detail
+    {
+        // Parentheses and ", " separators around count shortest round-trip scalars, each at most a sign,
+        // max_digits10 digits, a point and a signed exponent.
+        template<std::floating_point T>
+        constexpr std::size_t MaxTupleChars(std::size_t count) noexcept
+        {
+            int exponent = std::max(std::numeric_limits<T>::max_exponent10, std::numeric_limits<T>::digits10 - std::numeric_limits<T>::min_exponent10);
+            std::size_t exponentDigits = 1;
+            for (; exponent >= 10; exponent /= 10)
+            {
+                ++exponentDigits;
+            }
+
+            std::size_t scalar = 1 + static_cast<std::size_t>(std::numeric_limits<T>::max_digits10) + 1 + 2 + exponentDigits;
+            return 2 + count * scalar + (count - 1) * 2;
+        }
+    }
+
+    struct TextFormat
+    {
+        // Upper bound for one formatted item of count components of T.
+        template<std::floating_point T>
+        static constexpr std::size_t MaxItemChars(std::size_t count) noexcept
+        {
+            return Detail::MaxTupleChars<T>(count);
+        }
+
+        // Upper bound for one formatted item of any supported type and precision.
+        static constexpr std::size_t kMaxItemChars = Detail::MaxTupleChars<long double>(4);
+
+        template<std::floating_point T>
+        static std::to_chars_result ToChars(char* first, char* last, const Vector2<T>& v) noexcept
+        {
+            const T values[] = { v.x, v.y };
+            return WriteTuple(first, last, values);
+        }
+
+        template<std::floating_point T>
+        static std::to_chars_result ToChars(char* first, char* last, const Vector3<T>& v) noexcept
+        {
+            const T values[] = { v.x, v.y, v.z };
+            return WriteTuple(first, last, values);
+        }
+
+        template<std::floating_point T>
+        static std::to_chars_result ToChars(char* first, char* last, const Quaternion<T>& q) noexcept
+        {
+            const T values[] = { q.w, q.x, q.y, q.z };
+            return WriteTuple(first, last, values);
+        }
+
+        template<std::ranges::contiguous_range Range>
+        static std::to_chars_result ToChars(char* first, char* last, const Range& items, char separator = '\n') noexcept
+        {
+            for (const auto& item : items)
+            {
+                std::to_chars_result result = ToChars(first, last, item);
+                if (result.ec != std::errc() || result.ptr == last)
+                {
+                    return { last, std::errc::value_too_large };
+                }
+                *result.ptr = separator;
+                first = result.ptr + 1;
+            }
+            return { first, std::errc() };
+        }
+
+        // Fails only if an item does not fit in kMaxItemChars; the items before it stay appended.
+        template<std::ranges::contiguous_range Range>
+        static bool Append(std::string& out, const Range& items, char separator = '\n')
+        {
+            char buffer[kMaxItemChars + 1];
+            for (const auto& item : items)
+            {
+                std::to_chars_result result = ToChars(buffer, buffer + kMaxItemChars, item);
+                if (result.ec != std::errc())
+                {
+                    return false;
+                }
+                *result.ptr = separator;
+                out.append(buffer, result.ptr + 1);
+            }
+            return true;
+        }
+
+        template<std::floating_point T>
+        static bool Parse(std::string_view text, std::vector<Vector3<T>>& out, TextDialect dialect = TextDialect::XYZ)
+        {
+            std::size_t base = out.size();
+            bool parsed = ParseLines<T>(text, dialect,
+                [&](std::size_t count) { out.resize(base + count); },
+                [&](std::size_t index, const Vector3<T>& v) { out[base + index] = v; });
+
+            if (!parsed)
+            {
+                out.resize(base);
+            }
+            return parsed;
+        }
+
+        template<std::floating_point T>
+        static bool Parse(std::string_view text, Vector3SoA<T>& out, TextDialect dialect = TextDialect::XYZ)
+        {
+            std::size_t base = out.Size();
+            bool parsed = ParseLines<T>(text, dialect,
+                [&](std::size_t count) { out.Resize(base + count); },
+                [&](std::size_t index, const Vector3<T>& v) { out.Set(base + index, v); });
+
+            if (!parsed)
+            {
+                out.Resize(base);
+            }
+            return parsed;
+        }
+
+        template<typename Output>
+        static bool ParseFile(const std::filesystem::path& path, Output& out, TextDialect dialect = TextDialect::XYZ)
+        {
+            MappedFile file(path);
+            if (!file.IsOpen())
+            {
+                return false;
+            }
+
+            std::span<const std::byte> bytes = file.Bytes();
+            return Parse(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()), out, dialect);
+        }
+
+    private:
+        static constexpr std::size_t kParseChunkBytes = std::size_t(1) << 20;
+
+        static constexpr bool IsSeparator(char c) noexcept
+        {
+            return c == ' ' || c == '\t' || c == '\r' || c == ',' || c == '(' || c == ')';
+        }
+
+        static const char* SkipSeparators(const char* p, const char* end) noexcept
+        {
+            while (p < end && IsSeparator(*p))
+            {
+                ++p;
+            }
+            return p;
+        }
+
+        // Returns where the values of a data line start, or nullptr for lines that carry no vector.
+        static const char* ValuesBegin(const char* line, const char* end, TextDialect dialect) noexcept
+        {
+            if (dialect == TextDialect::OBJ)
+            {
+                return (end - line >= 2 && line[0] == 'v' && (line[1] == ' ' || line[1] == '\t')) ? line + 2 : nullptr;
+            }
+
+            const char* p = SkipSeparators(line, end);
+            return (p < end && *p != '#') ? p : nullptr;
+        }
+
+        template<std::floating_point T>
+        static bool ParseValues(const char* p, const char* end, Vector3<T>& out) noexcept
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                p = SkipSeparators(p, end);
+                std::from_chars_result result = std::from_chars(p, end, out[i]);
+                if (result.ec != std::errc())
+                {
+                    return false;
+                }
+                p = result.ptr;
+            }
+            return true;
+        }
+
+        template<typename Func>
+        static void ForEachLine(std::string_view text, Func&& func)
+        {
+            const char* p = text.data();
+            const char* end = text.data() + text.size();
+            while (p < end)
+            {
+                const char* lineEnd = std::find(p, end, '\n');
+                func(p, lineEnd);
+                p = (lineEnd < end) ? lineEnd + 1 : end;
+            }
+        }
+
+        template<std::floating_point T, typename Resize, typename Store>
+        static bool ParseLines(std::string_view text, TextDialect dialect, Resize&& resize, Store&& store)
+        {
+            // Split into roughly equal pieces that each start at the beginning of a line.
+            std::size_t pieceCount = std::max<std::size_t>(1, text.size() / kParseChunkBytes);
+            std::vector<std::size_t> bounds(pieceCount + 1, text.size());
+            bounds[0] = 0;
+            for (std::size_t i = 1; i < pieceCount; ++i)
+            {
+                std::size_t newline = text.find('\n', std::max(i * kParseChunkBytes, bounds[i - 1]));
+                bounds[i] = (newline == std::string_view::npos) ? text.size() : newline + 1;
+            }
+
+            auto piece = [&](std::size_t i) { return text.substr(bounds[i], bounds[i + 1] - bounds[i]); };
+
+            std::vector<std::size_t> offsets(pieceCount + 1, 0);
+            Detail::ParallelForEach(pieceCount, [&](std::size_t i)
+            {
+                ForEachLine(piece(i), [&](const char* line, const char* lineEnd)
+                {
+                    offsets[i + 1] += ValuesBegin(line, lineEnd, dialect) ? 1 : 0;
+                });
+            });
+            std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+            resize(offsets.back());
+
+            std::atomic<bool> failed = false;
+            Detail::ParallelForEach(pieceCount, [&](std::size_t i)
+            {
+                std::size_t index = offsets[i];
+                ForEachLine(piece(i), [&](const char* line, const char* lineEnd)
+                {
+                    const char* values = ValuesBegin(line, lineEnd, dialect);
+                    if (values)
+                    {
+                        Vector3<T> v;
+                        if (!ParseValues(values, lineEnd, v))
+                        {
+                            failed.store(true, std::memory_order_relaxed);
+                        }
+                        store(index++, v);
+                    }
+                });
+            });
+
+            return !failed.load();
+        }
+
+        template<std::floating_point T, std::size_t N>
+        static std::to_chars_result WriteTuple(char* first, char* last, const T (&values)[N]) noexcept
+        {
+            if (first == last)
+            {
+                return { last, std::errc::value_too_large };
+            }
+            *first++ = '(';
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (i > 0)
+                {
+                    if (last - first < 2)
+                    {
+                        return { last, std::errc::value_too_large };
+                    }
+                    *first++ = ',';
+                    *first++ = ' ';
+                }
+
+                std::to_chars_result result = std::to_chars(first, last, values[i]);
+                if (result.ec != std::errc())
+                {
+                    return result;
+                }
+                first = result.ptr;
+            }
+
+            if (first == last)
+            {
+                return { last, std::errc::value_too_large };
+            }
+            *first++ = ')';
+            return { first, std::errc() };
+        }
+    };
+}
@@ -0,0 +1,316 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <vector>
+#include "ArrayFile.h"
+#include "BitPacking.h"
+#include "Quaternion.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    struct TrajectoryHeader
+    {
+        static constexpr char kMagic[4] = { 'V', '2', '3', 'T' };
+        static constexpr std::uint16_t kVersion = 1;
+
+        char magic[4];
+        std::uint16_t version;
+        ArrayElement element;
+        ArrayPrecision precision;
+        std::uint32_t chunkSize;
+        std::uint32_t reserved;
+        double step;
+    };
+
+    struct TrajectoryFooter
+    {
+        std::uint64_t indexOffset;
+        std::uint64_t chunkCount;
+        std::uint64_t sampleCount;
+    };
+
+    static_assert(sizeof(TrajectoryHeader) == 24);
+    static_assert(sizeof(TrajectoryFooter) == 24);
+
+    namespace Detail
+    {
+        inline constexpr int kTrajectoryMaxLanes = 4;
+
+        struct TrajectoryChunkHeader
+        {
+            std::uint32_t count;
+            std::uint8_t widths[kTrajectoryMaxLanes];
+            std::int64_t base[kTrajectoryMaxLanes];
+            std::uint64_t wordCount;
+        };
+
+        template<typename Sample>
+        constexpr int LaneCount() noexcept
+        {
+            constexpr ArrayElement element = ArrayElementOf<Sample>::kElement;
+            return element == ArrayElement::Vector2 ? 2 : element == ArrayElement::Vector3 ? 3 : 4;
+        }
+    }
+
+    template<typename Sample>
+        requires requires { Detail::ArrayElementOf<Sample>::kElement; }
+    class TrajectoryWriter
+    {
+    public:
+        using Scalar = typename Detail::ArrayElementOf<Sample>::Scalar;
+
+        TrajectoryWriter(std::ostream& stream, double step, std::uint32_t chunkSize = 256)
+            : m_stream(stream), m_invStep(1.0 / step), m_chunkSize(chunkSize)
+        {
+            assert(step > 0.0 && chunkSize > 0);
+
+            TrajectoryHeader header = {};
+            std::memcpy(header.magic, TrajectoryHeader::kMagic, sizeof(header.magic));
+            header.version = TrajectoryHeader::kVersion;
+            header.element = Detail::ArrayElementOf<Sample>::kElement;
+            header.precision = ArrayFile::PrecisionOf<Scalar>();
+            header.chunkSize = chunkSize;
+            header.step = step;
+            Write(&header, sizeof(header));
+
+            m_quantized.reserve(static_cast<std::size_t>(chunkSize) * kLanes);
+        }
+
+        void Append(Sample sample)
+        {
+            if constexpr (Detail::ArrayElementOf<Sample>::kElement == ArrayElement::Quaternion)
+            {
+                // q and -q are the same rotation; stay in the previous sample's hemisphere to keep deltas small.
+                if (sample.Dot(m_previous) < kZero<Scalar>)
+                {
+                    sample = -sample;
+                }
+                m_previous = sample;
+            }
+
+            const Scalar* lanes = reinterpret_cast<const Scalar*>(&sample);
+            for (int l = 0; l < kLanes; ++l)
+            {
+                m_quantized.push_back(std::llround(static_cast<double>(lanes[l]) * m_invStep));
+            }
+
+            ++m_sampleCount;
+            if (m_quantized.size() == static_cast<std::size_t>(m_chunkSize) * kLanes)
+            {
+                FlushChunk();
+            }
+        }
+
+        bool Finish()
+        {
+            FlushChunk();
+
+            TrajectoryFooter footer = { m_offset, m_chunkOffsets.size(), m_sampleCount };
+            Write(m_chunkOffsets.data(), m_chunkOffsets.size() * sizeof(std::uint64_t));
+            Write(&footer, sizeof(footer));
+            return static_cast<bool>(m_stream.flush());
+        }
+
+    private:
+        static constexpr int kLanes = Detail::LaneCount<Sample>();
+
+        std::ostream& m_stream;
+        double m_invStep;
+        std::uint32_t m_chunkSize;
+        std::uint64_t m_offset = 0;
+        std::uint64_t m_sampleCount = 0;
+        std::vector<std::int64_t> m_quantized;
+        std::vector<std::uint64_t> m_words;
+        std::vector<std::uint64_t> m_chunkOffsets;
+        Sample m_previous;
+
+        void Write(const void* data, std::size_t size)
+        {
+            m_stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            m_offset += size;
+        }
+
+        void FlushChunk()
+        {
+            std::size_t count = m_quantized.size() / kLanes;
+            if (count == 0)
+            {
+                return;
+            }
+
+            Detail::TrajectoryChunkHeader header = {};
+            header.count = static_cast<std::uint32_t>(count);
+            for (int l = 0; l < kLanes; ++l)
+            {
+                header.base[l] = m_quantized[l];
+
+                std::uint64_t bits = 0;
+                for (std::size_t i = 1; i < count; ++i)
+                {
+                    bits |= Detail::ZigZag(m_quantized[i * kLanes + l] - m_quantized[(i - 1) * kLanes + l]);
+                }
+                header.widths[l] = static_cast<std::uint8_t>(std::bit_width(bits));
+            }
+
+            m_words.clear();
+            Detail::BitWriter writer(m_words);
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                for (int l = 0; l < kLanes; ++l)
+                {
+                    if (header.widths[l] > 0)
+                    {
+                        writer.Write(Detail::ZigZag(m_quantized[i * kLanes + l] - m_quantized[(i - 1) * kLanes + l]), header.widths[l]);
+                    }
+                }
+            }
+            writer.Flush();
+
+            header.wordCount = m_words.size();
+            m_chunkOffsets.push_back(m_offset);
+            Write(&header, sizeof(header));
+            Write(m_words.data(), m_words.size() * sizeof(std::uint64_t));
+            m_quantized.clear();
+        }
+    };
+
+    template<typename Sample>
+        requires requires { Detail::ArrayElementOf<Sample>::kElement; }
+    class TrajectoryReader
+    {
+    public:
+        using Scalar = typename Detail::ArrayElementOf<Sample>::Scalar;
+
+        explicit TrajectoryReader(std::span<const std::byte> data) noexcept : m_data(data)
+        {
+            if (data.size() < sizeof(TrajectoryHeader) + sizeof(TrajectoryFooter))
+            {
+                return;
+            }
+
+            std::memcpy(&m_header, data.data(), sizeof(m_header));
+            std::memcpy(&m_footer, data.data() + data.size() - sizeof(m_footer), sizeof(m_footer));
+
+            std::uint64_t indexEnd = data.size() - sizeof(m_footer);
+            m_valid = std::memcmp(m_header.magic, TrajectoryHeader::kMagic, sizeof(m_header.magic)) == 0 &&
+                m_header.version == TrajectoryHeader::kVersion &&
+                m_header.element == Detail::ArrayElementOf<Sample>::kElement &&
+                m_header.precision == ArrayFile::PrecisionOf<Scalar>() &&
+                m_header.chunkSize > 0 &&
+                m_footer.indexOffset <= indexEnd &&
+                m_footer.chunkCount == (indexEnd - m_footer.indexOffset) / sizeof(std::uint64_t) &&
+                m_footer.sampleCount <= m_footer.chunkCount * m_header.chunkSize;
+        }
+
+        bool IsValid() const noexcept
+        {
+            return m_valid;
+        }
+
+        std::size_t SampleCount() const noexcept
+        {
+            return m_valid ? static_cast<std::size_t>(m_footer.sampleCount) : 0;
+        }
+
+        std::size_t ChunkCount() const noexcept
+        {
+            return m_valid ? static_cast<std::size_t>(m_footer.chunkCount) : 0;
+        }
+
+        std::size_t ChunkSize() const noexcept
+        {
+            return m_header.chunkSize;
+        }
+
+        std::size_t DecodeChunk(std::size_t chunk, std::span<Sample> out) const noexcept
+        {
+            if (chunk >= ChunkCount())
+            {
+                return 0;
+            }
+
+            std::uint64_t offset;
+            std::memcpy(&offset, m_data.data() + m_footer.indexOffset + chunk * sizeof(std::uint64_t), sizeof(offset));
+
+            Detail::TrajectoryChunkHeader header;
+            if (offset > m_footer.indexOffset || m_footer.indexOffset - offset < sizeof(header))
+            {
+                return 0;
+            }
+            std::memcpy(&header, m_data.data() + offset, sizeof(header));
+
+            const std::byte* words = m_data.data() + offset + sizeof(header);
+            if (header.wordCount > (m_footer.indexOffset - offset - sizeof(header)) / sizeof(std::uint64_t))
+            {
+                return 0;
+            }
+
+            // Widths come from the file: anything wider than a word, or more bits than the chunk holds, is corrupt.
+            std::uint64_t sampleBits = 0;
+            for (int l = 0; l < kLanes; ++l)
+            {
+                if (header.widths[l] > 64)
+                {
+                    return 0;
+                }
+                sampleBits += header.widths[l];
+            }
+            if (header.count > 1 && sampleBits > 0 && header.count - 1 > header.wordCount * 64 / sampleBits)
+            {
+                return 0;
+            }
+
+            std::size_t count = std::min<std::size_t>({ header.count, out.size(), m_header.chunkSize });
+            std::int64_t current[Detail::kTrajectoryMaxLanes];
+            std::copy(header.base, header.base + kLanes, current);
+
+            Detail::BitReader reader(words, static_cast<std::size_t>(header.wordCount));
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (i > 0)
+                {
+                    for (int l = 0; l < kLanes; ++l)
+                    {
+                        if (header.widths[l] > 0)
+                        {
+                            current[l] += Detail::UnZigZag(reader.Read(header.widths[l]));
+                        }
+                    }
+                }
+
+                Scalar* lanes = reinterpret_cast<Scalar*>(&out[i]);
+                for (int l = 0; l < kLanes; ++l)
+                {
+                    lanes[l] = static_cast<Scalar>(static_cast<double>(current[l]) * m_header.step);
+                }
+
+                if constexpr (Detail::ArrayElementOf<Sample>::kElement == ArrayElement::Quaternion)
+                {
+                    out[i].Normalize();
+                }
+            }
+
+            return count;
+        }
+
+    private:
+        static constexpr int kLanes = Detail::LaneCount<Sample>();
+
+        std::span<const std::byte> m_data;
+        TrajectoryHeader m_header = {};
+        TrajectoryFooter m_footer = {};
+        bool m_valid = false;
+    };
+}
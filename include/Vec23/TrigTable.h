@@ -0,0 +1,242 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Constants.h"
+#include "Quaternion.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    namespace Detail
+    {
+        inline constexpr std::size_t kTrigTableSize = 4096;
+
+        // Taylor series, only evaluated on [0, pi/2] while the table is generated.
+        constexpr long double SeriesSin(long double radians) noexcept
+        {
+            long double term = radians;
+            long double sum = radians;
+            long double squared = radians * radians;
+            for (int n = 1; n < 30; ++n)
+            {
+                term *= -squared / static_cast<long double>((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        // One full turn of sines plus a guard entry, so interpolation never wraps. The first quadrant is
+        // evaluated and the others mirrored from it, which keeps the table exactly symmetric.
+        template<std::floating_point T>
+        constexpr std::array<T, kTrigTableSize + 1> MakeSinTable() noexcept
+        {
+            constexpr std::size_t quarter = kTrigTableSize / 4;
+            std::array<T, kTrigTableSize + 1> table{};
+            for (std::size_t i = 0; i <= quarter; ++i)
+            {
+                long double radians = kPi<long double> * kHalf<long double> * static_cast<long double>(i) / quarter;
+                T value = static_cast<T>(SeriesSin(radians));
+                table[i] = value;
+                table[2 * quarter - i] = value;
+                table[2 * quarter + i] = -value;
+                table[kTrigTableSize - i] = -value;
+            }
+            table[0] = table[2 * quarter] = table[kTrigTableSize] = kZero<T>;
+            return table;
+        }
+
+        template<std::floating_point T>
+        inline constexpr std::array<T, kTrigTableSize + 1> kSinTable = MakeSinTable<T>();
+    }
+
+    // Table-driven sine and cosine with linear interpolation (error below 3e-7), and table-driven
+    // versions of the trig-heavy constructors. Meant for hot paths that tolerate float-level accuracy.
+    template<std::floating_point T>
+    struct TrigTable
+    {
+        static constexpr std::size_t kSize = Detail::kTrigTableSize;
+
+        static T Sin(T degrees) noexcept
+        {
+            T sinT;
+            T cosT;
+            SinCos(degrees, sinT, cosT);
+            return sinT;
+        }
+
+        static T Cos(T degrees) noexcept
+        {
+            T sinT;
+            T cosT;
+            SinCos(degrees, sinT, cosT);
+            return cosT;
+        }
+
+        // Angles are wrapped to one turn first, so large ones keep their fraction and the index conversion
+        // stays in range. NaN and infinite angles read entry 0 and come out as NaN.
+        static void SinCos(T degrees, T& outSin, T& outCos) noexcept
+        {
+            const auto& table = Detail::kSinTable<T>;
+
+            T position = std::fmod(degrees, T(360)) * (static_cast<T>(kSize) / T(360));
+            T whole = std::floor(position);
+            T fraction = position - whole;
+            whole = (whole == whole) ? whole : kZero<T>;
+
+            std::size_t index = static_cast<std::size_t>(static_cast<std::int64_t>(whole)) & (kSize - 1);
+            std::size_t cosIndex = (index + kSize / 4) & (kSize - 1);
+
+            outSin = table[index] + (table[index + 1] - table[index]) * fraction;
+            outCos = table[cosIndex] + (table[cosIndex + 1] - table[cosIndex]) * fraction;
+        }
+
+        // -------------------------
+        // Utilities
+        // -------------------------
+
+        static Quaternion<T> FromAxisAngle(const UnitVector3<T>& axis, T degrees) noexcept
+        {
+            T sinT;
+            T cosT;
+            SinCos(degrees * kHalf<T>, sinT, cosT);
+            return { cosT, axis.Get().x * sinT, axis.Get().y * sinT, axis.Get().z * sinT };
+        }
+
+        static Quaternion<T> FromAxisAngle(const Vector3<T>& axis, T degrees) noexcept
+        {
+            if (axis.LengthSquared() <= kSafetyEpsilon<T>)
+            {
+                return Quaternion<T>::Identity();
+            }
+
+            return FromAxisAngle(UnitVector3<T>(axis), degrees);
+        }
+
+        static Quaternion<T> FromEuler(T rollDegrees, T pitchDegrees, T yawDegrees) noexcept
+        {
+            T sinRoll;
+            T cosRoll;
+            SinCos(rollDegrees * kHalf<T>, sinRoll, cosRoll);
+
+            T sinPitch;
+            T cosPitch;
+            SinCos(pitchDegrees * kHalf<T>, sinPitch, cosPitch);
+
+            T sinYaw;
+            T cosYaw;
+            SinCos(yawDegrees * kHalf<T>, sinYaw, cosYaw);
+
+            return Quaternion<T>(
+                cosRoll * cosPitch * cosYaw + sinRoll * sinPitch * sinYaw,
+                sinRoll * cosPitch * cosYaw - cosRoll * sinPitch * sinYaw,
+                cosRoll * sinPitch * cosYaw + sinRoll * cosPitch * sinYaw,
+                cosRoll * cosPitch * sinYaw - sinRoll * sinPitch * cosYaw
+            );
+        }
+
+        static Vector2<T> GetRotated(const Vector2<T>& v, T degrees) noexcept
+        {
+            T sinT;
+            T cosT;
+            SinCos(degrees, sinT, cosT);
+            return { (v.x * cosT) - (v.y * sinT), (v.x * sinT) + (v.y * cosT) };
+        }
+    };
+
+    // Rotations about the principal axes, precomputed for every multiple of a fixed step. Angles are
+    // rounded to the nearest step, so lookups are exact for controllers that work on that grid.
+    template<std::floating_point T>
+    class QuaternionCache
+    {
+    public:
+        explicit QuaternionCache(T stepDegrees = T(0.1))
+        {
+            assert(stepDegrees > kZero<T>);
+
+            std::size_t count = static_cast<std::size_t>(std::llround(T(360) / stepDegrees));
+            assert(count > 0);
+            m_stepsPerDegree = static_cast<T>(count) / T(360);
+
+            m_aboutX.reserve(count);
+            m_aboutY.reserve(count);
+            m_aboutZ.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                T degrees = static_cast<T>(i) / m_stepsPerDegree;
+                m_aboutX.push_back(Quaternion<T>::FromAxisAngle(UnitVector3<T>::UnitX(), degrees));
+                m_aboutY.push_back(Quaternion<T>::FromAxisAngle(UnitVector3<T>::UnitY(), degrees));
+                m_aboutZ.push_back(Quaternion<T>::FromAxisAngle(UnitVector3<T>::UnitZ(), degrees));
+            }
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        std::size_t size() const noexcept
+        {
+            return m_aboutX.size();
+        }
+
+        T Step() const noexcept
+        {
+            return kOne<T> / m_stepsPerDegree;
+        }
+
+        // Angles a full turn apart map to the same entry; q and -q describe the same rotation.
+        const Quaternion<T>& AboutX(T degrees) const noexcept
+        {
+            return m_aboutX[Index(degrees)];
+        }
+
+        const Quaternion<T>& AboutY(T degrees) const noexcept
+        {
+            return m_aboutY[Index(degrees)];
+        }
+
+        const Quaternion<T>& AboutZ(T degrees) const noexcept
+        {
+            return m_aboutZ[Index(degrees)];
+        }
+
+        // Same convention as Quaternion::FromEuler: roll about X, then pitch about Y, then yaw about Z.
+        Quaternion<T> FromEuler(T rollDegrees, T pitchDegrees, T yawDegrees) const noexcept
+        {
+            return AboutZ(yawDegrees) * AboutY(pitchDegrees) * AboutX(rollDegrees);
+        }
+
+    private:
+        T m_stepsPerDegree = kOne<T>;
+        std::vector<Quaternion<T>> m_aboutX;
+        std::vector<Quaternion<T>> m_aboutY;
+        std::vector<Quaternion<T>> m_aboutZ;
+
+        // NaN and infinite angles map to the 0 degree entry.
+        std::size_t Index(T degrees) const noexcept
+        {
+            T wrapped = std::fmod(degrees, T(360));
+            wrapped = (wrapped == wrapped) ? wrapped : kZero<T>;
+
+            std::int64_t count = static_cast<std::int64_t>(m_aboutX.size());
+            std::int64_t step = std::llround(wrapped * m_stepsPerDegree) % count;
+            return static_cast<std::size_t>(step < 0 ? step + count : step);
+        }
+    };
+
+    using FTrigTable = TrigTable<float>;
+    using DTrigTable = TrigTable<double>;
+    using LDTrigTable = TrigTable<long double>;
+
+    using FQuaternionCache = QuaternionCache<float>;
+    using DQuaternionCache = QuaternionCache<double>;
+    using LDQuaternionCache = QuaternionCache<long double>;
+}
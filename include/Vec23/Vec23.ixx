@@ -1,16 +1,71 @@
 module;
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <charconv>
+#include <compare>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <execution>
+#include <filesystem>
 #include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <ostream>
+#include <ranges>
+#include <span>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "Constants.h"
+#include "Instrumentation.h"
 #include "Vector2.h"
 #include "Vector3.h"
+#include "VectorN.h"
 #include "Quaternion.h"
+#include "Aligned.h"
+#include "Fixed.h"
+#include "FixedVector2.h"
+#include "FixedVector3.h"
+#include "FixedQuaternion.h"
+#include "Parallel.h"
+#include "Arena.h"
+#include "BatchMath.h"
+#include "BitPacking.h"
+#include "Expression.h"
+#include "MappedFile.h"
+#include "SoA.h"
+#include "StridedView.h"
+#include "ArrayFile.h"
+#include "BoundingVolume.h"
+#include "ChangeDetection.h"
+#include "DeltaCodec.h"
+#include "Interpolation.h"
+#include "PointCloud.h"
+#include "Polygon2.h"
+#include "RigidTransform.h"
+#include "Rotation.h"
+#include "SnapshotStore.h"
+#include "TextFormat.h"
+#include "Trajectory.h"
+#include "TrigTable.h"
+#include "VertexWeld.h"
+#include "WorldPosition.h"
 
 export module Vec23;
 
@@ -26,9 +81,21 @@ export namespace Vec23
     using Vec23::kToleranceEpsilon;
     using Vec23::kSafetyEpsilon;
 
+    using Vec23::Counter;
+    using Vec23::kCounterCount;
+    using Vec23::CounterName;
+    using Vec23::CounterReport;
+    using Vec23::Instrumentation;
+
     using Vec23::Vector2;
     using Vec23::Vector3;
+    using Vec23::VectorN;
+    using Vec23::Vector4;
     using Vec23::Quaternion;
+    using Vec23::UnitVector3;
+    using Vec23::UnitQuaternion;
+    using Vec23::Vector3A;
+    using Vec23::QuaternionA;
 
     using FVector2 = Vector2<float>;
     using DVector2 = Vector2<double>;
@@ -38,7 +105,180 @@ export namespace Vec23
     using DVector3 = Vector3<double>;
     using LDVector3 = Vector3<long double>;
 
+    using FVector4 = Vector4<float>;
+    using DVector4 = Vector4<double>;
+    using LDVector4 = Vector4<long double>;
+
     using FQuaternion = Quaternion<float>;
     using DQuaternion = Quaternion<double>;
     using LDQuaternion = Quaternion<long double>;
+
+    using FUnitVector3 = UnitVector3<float>;
+    using DUnitVector3 = UnitVector3<double>;
+    using LDUnitVector3 = UnitVector3<long double>;
+
+    using FUnitQuaternion = UnitQuaternion<float>;
+    using DUnitQuaternion = UnitQuaternion<double>;
+    using LDUnitQuaternion = UnitQuaternion<long double>;
+
+    using FVector3A = Vector3A<float>;
+    using DVector3A = Vector3A<double>;
+    using LDVector3A = Vector3A<long double>;
+
+    using FQuaternionA = QuaternionA<float>;
+    using DQuaternionA = QuaternionA<double>;
+    using LDQuaternionA = QuaternionA<long double>;
+
+    using Vec23::Fixed;
+    using Vec23::FixedPoint;
+    using Vec23::FixedVector2;
+    using Vec23::FixedVector3;
+    using Vec23::FixedQuaternion;
+
+    using Q16_16 = Fixed<std::int32_t, 16>;
+    using Q32_32 = Fixed<std::int64_t, 32>;
+
+    using Q16Vector2 = FixedVector2<Q16_16>;
+    using Q32Vector2 = FixedVector2<Q32_32>;
+
+    using Q16Vector3 = FixedVector3<Q16_16>;
+    using Q32Vector3 = FixedVector3<Q32_32>;
+
+    using Q16Quaternion = FixedQuaternion<Q16_16>;
+    using Q32Quaternion = FixedQuaternion<Q32_32>;
+
+    using Vec23::MappedFile;
+    using Vec23::FrameArena;
+    using Vec23::Vector3SoA;
+    using Vec23::QuaternionSoA;
+    using Vec23::Vector3Expression;
+    using Vec23::Vector3ExpressionOperators;
+    using Vec23::BinaryExpression;
+    using Vec23::ScaleExpression;
+
+    using FVector3SoA = Vector3SoA<float>;
+    using DVector3SoA = Vector3SoA<double>;
+    using LDVector3SoA = Vector3SoA<long double>;
+
+    using FQuaternionSoA = QuaternionSoA<float>;
+    using DQuaternionSoA = QuaternionSoA<double>;
+    using LDQuaternionSoA = QuaternionSoA<long double>;
+
+    using Vec23::StridedView;
+    using Vec23::Vector2View;
+    using Vec23::Vector3View;
+    using Vec23::QuaternionView;
+    using Vec23::ConstVector2View;
+    using Vec23::ConstVector3View;
+    using Vec23::ConstQuaternionView;
+
+    using FVector3View = Vector3View<float>;
+    using DVector3View = Vector3View<double>;
+    using LDVector3View = Vector3View<long double>;
+
+    using FQuaternionView = QuaternionView<float>;
+    using DQuaternionView = QuaternionView<double>;
+    using LDQuaternionView = QuaternionView<long double>;
+
+    using Vec23::ArrayElement;
+    using Vec23::ArrayPrecision;
+    using Vec23::ArrayLayout;
+    using Vec23::ArrayFileHeader;
+    using Vec23::ArrayFile;
+    using Vec23::MappedArrayFile;
+    using Vec23::BoundingSphere;
+    using Vec23::OrientedBox;
+    using Vec23::Covariance3;
+    using Vec23::ChangeSet;
+    using Vec23::ChangeDetection;
+    using Vec23::QuantizedVector3SoA;
+    using Vec23::Vector3DeltaCodec;
+    using Vec23::InterpolationBuffer;
+    using Vec23::PointCloud;
+    using Vec23::Polygon2;
+    using Vec23::ConvexHull2;
+    using Vec23::RigidTransform;
+    using Vec23::Rotation2;
+    using Vec23::AxisRotation3;
+    using Vec23::SnapshotStore;
+    using Vec23::Vector3Store;
+    using Vec23::QuaternionStore;
+    using Vec23::TextDialect;
+    using Vec23::TextFormat;
+    using Vec23::TrajectoryHeader;
+    using Vec23::TrajectoryFooter;
+    using Vec23::TrajectoryWriter;
+    using Vec23::TrajectoryReader;
+    using Vec23::TrigTable;
+    using Vec23::QuaternionCache;
+    using Vec23::VertexWeld;
+    using Vec23::WorldPosition;
+
+    using FBoundingSphere = BoundingSphere<float>;
+    using DBoundingSphere = BoundingSphere<double>;
+    using LDBoundingSphere = BoundingSphere<long double>;
+
+    using FOrientedBox = OrientedBox<float>;
+    using DOrientedBox = OrientedBox<double>;
+    using LDOrientedBox = OrientedBox<long double>;
+
+    using FCovariance3 = Covariance3<float>;
+    using DCovariance3 = Covariance3<double>;
+    using LDCovariance3 = Covariance3<long double>;
+
+    using FChangeDetection = ChangeDetection<float>;
+    using DChangeDetection = ChangeDetection<double>;
+    using LDChangeDetection = ChangeDetection<long double>;
+
+    using FVector3DeltaCodec = Vector3DeltaCodec<float>;
+    using DVector3DeltaCodec = Vector3DeltaCodec<double>;
+    using LDVector3DeltaCodec = Vector3DeltaCodec<long double>;
+
+    using FInterpolationBuffer = InterpolationBuffer<float>;
+    using DInterpolationBuffer = InterpolationBuffer<double>;
+    using LDInterpolationBuffer = InterpolationBuffer<long double>;
+
+    using FPointCloud = PointCloud<float>;
+    using DPointCloud = PointCloud<double>;
+    using LDPointCloud = PointCloud<long double>;
+
+    using FPolygon2 = Polygon2<float>;
+    using DPolygon2 = Polygon2<double>;
+    using LDPolygon2 = Polygon2<long double>;
+
+    using FConvexHull2 = ConvexHull2<float>;
+    using DConvexHull2 = ConvexHull2<double>;
+    using LDConvexHull2 = ConvexHull2<long double>;
+
+    using FRigidTransform = RigidTransform<float>;
+    using DRigidTransform = RigidTransform<double>;
+    using LDRigidTransform = RigidTransform<long double>;
+
+    using FRotation2 = Rotation2<float>;
+    using DRotation2 = Rotation2<double>;
+    using LDRotation2 = Rotation2<long double>;
+
+    using FAxisRotation3 = AxisRotation3<float>;
+    using DAxisRotation3 = AxisRotation3<double>;
+    using LDAxisRotation3 = AxisRotation3<long double>;
+
+    using FVector3Store = Vector3Store<float>;
+    using DVector3Store = Vector3Store<double>;
+    using LDVector3Store = Vector3Store<long double>;
+
+    using FQuaternionStore = QuaternionStore<float>;
+    using DQuaternionStore = QuaternionStore<double>;
+    using LDQuaternionStore = QuaternionStore<long double>;
+
+    using FTrigTable = TrigTable<float>;
+    using DTrigTable = TrigTable<double>;
+    using LDTrigTable = TrigTable<long double>;
+
+    using FQuaternionCache = QuaternionCache<float>;
+    using DQuaternionCache = QuaternionCache<double>;
+    using LDQuaternionCache = QuaternionCache<long double>;
+
+    using FVertexWeld = VertexWeld<float>;
+    using DVertexWeld = VertexWeld<double>;
+    using LDVertexWeld = VertexWeld<long double>;
 }
@@ -8,6 +8,7 @@
 #include <format>
 #include <string>
 #include "Constants.h"
+#include "Instrumentation.h"
 
 namespace Vec23
 {
@@ -27,6 +28,7 @@ namespace Vec23
 
         void Normalize() noexcept
         {
+            VEC23_COUNT(Vector2Normalize);
             T lengthSq = LengthSquared();
             if (lengthSq > kSafetyEpsilon<T>)
             {
@@ -36,6 +38,7 @@ namespace Vec23
             }
             else
             {
+                VEC23_COUNT(Vector2NormalizeDegenerate);
                 x = y = kZero<T>;
             }
         }
@@ -101,7 +104,7 @@ namespace Vec23
 
         std::string ToString() const
         {
-            return std::format("({}, {})", x, y);
+            return std::format("{}", *this);
         }
 
         // -------------------------
@@ -226,3 +229,22 @@ namespace Vec23
     using DVector2 = Vector2<double>;
     using LDVector2 = Vector2<long double>;
 }
+
+template<std::floating_point T>
+struct std::formatter<Vec23::Vector2<T>> : std::formatter<T>
+{
+    template<typename FormatContext>
+    auto format(const Vec23::Vector2<T>& v, FormatContext& ctx) const
+    {
+        auto out = ctx.out();
+        *out++ = '(';
+        ctx.advance_to(out);
+        out = std::formatter<T>::format(v.x, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<T>::format(v.y, ctx);
+        *out++ = ')';
+        return out;
+    }
+};
@@ -8,9 +8,13 @@
 #include <format>
 #include <string>
 #include "Constants.h"
+#include "Instrumentation.h"
 
 namespace Vec23
 {
+    template<std::floating_point T>
+    class UnitVector3;
+
     template<std::floating_point T>
     struct Vector3
     {
@@ -28,6 +32,7 @@ namespace Vec23
 
         void Normalize() noexcept
         {
+            VEC23_COUNT(Vector3Normalize);
             T lengthSq = LengthSquared();
             if (lengthSq > kSafetyEpsilon<T>)
             {
@@ -38,24 +43,25 @@ namespace Vec23
             }
             else
             {
+                VEC23_COUNT(Vector3NormalizeDegenerate);
                 x = y = z = kZero<T>;
             }
         }
 
         void Rotate(T degrees, const Vector3& axis) noexcept
         {
-            T radians = degrees * kDegreesToRadians<T>;
-            T cosT = std::cos(radians);
-            T sinT = std::sin(radians);
-
             Vector3 u = axis;
             if (std::abs(u.LengthSquared() - kOne<T>) > kSafetyEpsilon<T>)
             {
                 u.Normalize();
             }
 
-            Vector3 v = *this;
-            *this = (v * cosT) + (u.Cross(v) * sinT) + (u * u.Dot(v) * (kOne<T> - cosT));
+            RotateAroundUnit(degrees, u);
+        }
+
+        void Rotate(T degrees, const UnitVector3<T>& axis) noexcept
+        {
+            RotateAroundUnit(degrees, axis.Get());
         }
 
         // -------------------------
@@ -81,6 +87,13 @@ namespace Vec23
             return result;
         }
 
+        Vector3 GetRotated(T degrees, const UnitVector3<T>& axis) const noexcept
+        {
+            Vector3 result = *this;
+            result.Rotate(degrees, axis);
+            return result;
+        }
+
         T Length() const noexcept
         {
             return std::hypot(x, y, z);
@@ -113,7 +126,7 @@ namespace Vec23
 
         std::string ToString() const
         {
-            return std::format("({}, {}, {})", x, y, z);
+            return std::format("{}", *this);
         }
 
         // -------------------------
@@ -240,9 +253,145 @@ namespace Vec23
         {
             return v * scalar;
         }
+
+    private:
+        void RotateAroundUnit(T degrees, const Vector3& u) noexcept
+        {
+            T radians = degrees * kDegreesToRadians<T>;
+            T cosT = std::cos(radians);
+            T sinT = std::sin(radians);
+
+            Vector3 v = *this;
+            *this = (v * cosT) + (u.Cross(v) * sinT) + (u * u.Dot(v) * (kOne<T> - cosT));
+        }
+    };
+
+    // Vector3 that is normalized on construction, so APIs taking it can skip the length check.
+    template<std::floating_point T>
+    class UnitVector3
+    {
+    public:
+        constexpr UnitVector3() noexcept : m_value(kOne<T>, kZero<T>, kZero<T>) {}
+
+        // Degenerate input falls back to the X axis.
+        explicit UnitVector3(const Vector3<T>& v) noexcept : m_value(v.GetNormalized())
+        {
+            if (m_value == Vector3<T>())
+            {
+                m_value.x = kOne<T>;
+            }
+        }
+
+        static UnitVector3 FromNormalized(const Vector3<T>& v) noexcept
+        {
+            assert(v.IsNormalized());
+            return UnitVector3(v, Trusted());
+        }
+
+        static constexpr UnitVector3 UnitX() noexcept
+        {
+            return UnitVector3(Vector3<T>(kOne<T>, kZero<T>, kZero<T>), Trusted());
+        }
+
+        static constexpr UnitVector3 UnitY() noexcept
+        {
+            return UnitVector3(Vector3<T>(kZero<T>, kOne<T>, kZero<T>), Trusted());
+        }
+
+        static constexpr UnitVector3 UnitZ() noexcept
+        {
+            return UnitVector3(Vector3<T>(kZero<T>, kZero<T>, kOne<T>), Trusted());
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        constexpr const Vector3<T>& Get() const noexcept
+        {
+            return m_value;
+        }
+
+        constexpr operator const Vector3<T>&() const noexcept
+        {
+            return m_value;
+        }
+
+        constexpr T Dot(const Vector3<T>& other) const noexcept
+        {
+            return m_value.Dot(other);
+        }
+
+        constexpr Vector3<T> Cross(const Vector3<T>& other) const noexcept
+        {
+            return m_value.Cross(other);
+        }
+
+        UnitVector3 GetRotated(T degrees, const UnitVector3& axis) const noexcept
+        {
+            return UnitVector3(m_value.GetRotated(degrees, axis), Trusted());
+        }
+
+        std::string ToString() const
+        {
+            return m_value.ToString();
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const UnitVector3& other) const noexcept = default;
+
+        constexpr UnitVector3 operator-() const noexcept
+        {
+            return UnitVector3(-m_value, Trusted());
+        }
+
+        constexpr Vector3<T> operator*(T scalar) const noexcept
+        {
+            return m_value * scalar;
+        }
+
+    private:
+        struct Trusted {};
+
+        Vector3<T> m_value;
+
+        constexpr UnitVector3(const Vector3<T>& v, Trusted) noexcept : m_value(v) {}
+
+        template<std::floating_point>
+        friend class UnitQuaternion;
     };
 
     using FVector3 = Vector3<float>;
     using DVector3 = Vector3<double>;
     using LDVector3 = Vector3<long double>;
+
+    using FUnitVector3 = UnitVector3<float>;
+    using DUnitVector3 = UnitVector3<double>;
+    using LDUnitVector3 = UnitVector3<long double>;
 }
+
+template<std::floating_point T>
+struct std::formatter<Vec23::Vector3<T>> : std::formatter<T>
+{
+    template<typename FormatContext>
+    auto format(const Vec23::Vector3<T>& v, FormatContext& ctx) const
+    {
+        auto out = ctx.out();
+        *out++ = '(';
+        ctx.advance_to(out);
+        out = std::formatter<T>::format(v.x, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<T>::format(v.y, ctx);
+        *out++ = ',';
+        *out++ = ' ';
+        ctx.advance_to(out);
+        out = std::formatter<T>::format(v.z, ctx);
+        *out++ = ')';
+        return out;
+    }
+};
@@ -0,0 +1,342 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <string>
+#include "Constants.h"
+#include "Instrumentation.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    namespace Detail
+    {
+        // Three floats are padded to a fourth lane, like Vector3A, so they fill a 128-bit register too.
+        template<std::floating_point T, std::size_t N>
+        inline constexpr std::size_t kVectorLanes = (N == 3 && sizeof(T) * 4 == 16) ? 4 : N;
+
+        // Sizes that fill a 128-bit register exactly (float x3 padded, float x4, double x2) get that alignment,
+        // so loads and stores map to single aligned vector moves.
+        template<std::floating_point T, std::size_t N>
+        inline constexpr std::size_t kVectorAlignment = (sizeof(T) * kVectorLanes<T, N> == 16) ? 16 : alignof(T);
+    }
+
+    // Fixed-size vector with the operations Vector2 and Vector3 share, written once as loops over N so
+    // the compiler can vectorize them for every size.
+    template<std::floating_point T, std::size_t N>
+        requires (N > 0)
+    struct VectorN
+    {
+        // Lanes stored, N plus any padding. Padding lanes are held at zero, so every loop runs over all of
+        // them and compiles to whole-register operations. They sit at the end of components, which is public
+        // for aggregate access; writing them breaks Dot and ==, so index through operator[] or below N.
+        static constexpr std::size_t kLanes = Detail::kVectorLanes<T, N>;
+
+        alignas(Detail::kVectorAlignment<T, N>) std::array<T, kLanes> components{};
+
+        constexpr VectorN() noexcept = default;
+
+        template<std::convertible_to<T>... Args>
+            requires (sizeof...(Args) == N && N > 1)
+        constexpr VectorN(Args... args) noexcept : components{ static_cast<T>(args)... } {}
+
+        static constexpr VectorN Filled(T value) noexcept
+        {
+            VectorN result;
+            std::fill_n(result.components.begin(), N, value);
+            return result;
+        }
+
+        constexpr VectorN(const Vector2<T>& v) noexcept requires (N == 2) : components{ v.x, v.y } {}
+
+        constexpr VectorN(const Vector3<T>& v) noexcept requires (N == 3) : components{ v.x, v.y, v.z } {}
+
+        constexpr VectorN(const Vector3<T>& v, T w) noexcept requires (N == 4) : components{ v.x, v.y, v.z, w } {}
+
+        // Homogeneous point (w = 1), affected by translation.
+        static constexpr VectorN FromPoint(const Vector3<T>& v) noexcept requires (N == 4)
+        {
+            return { v, kOne<T> };
+        }
+
+        // Homogeneous direction (w = 0), unaffected by translation.
+        static constexpr VectorN FromDirection(const Vector3<T>& v) noexcept requires (N == 4)
+        {
+            return { v, kZero<T> };
+        }
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        void Normalize() noexcept
+        {
+            VEC23_COUNT(VectorNNormalize);
+            T lengthSq = LengthSquared();
+            if (lengthSq > kSafetyEpsilon<T>)
+            {
+                *this *= kOne<T> / std::sqrt(lengthSq);
+            }
+            else
+            {
+                VEC23_COUNT(VectorNNormalizeDegenerate);
+                components.fill(kZero<T>);
+            }
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        bool IsNormalized() const noexcept
+        {
+            return std::abs(LengthSquared() - kOne<T>) < kToleranceEpsilon<T>;
+        }
+
+        VectorN GetNormalized() const noexcept
+        {
+            VectorN result = *this;
+            result.Normalize();
+            return result;
+        }
+
+        T Length() const noexcept
+        {
+            return std::sqrt(LengthSquared());
+        }
+
+        constexpr T LengthSquared() const noexcept
+        {
+            return Dot(*this);
+        }
+
+        constexpr T Dot(const VectorN& other) const noexcept
+        {
+            T result = kZero<T>;
+            for (std::size_t i = 0; i < kLanes; ++i)
+            {
+                result += components[i] * other.components[i];
+            }
+            return result;
+        }
+
+        constexpr Vector2<T> ToVector2() const noexcept requires (N >= 2)
+        {
+            return { components[0], components[1] };
+        }
+
+        constexpr Vector3<T> ToVector3() const noexcept requires (N >= 3)
+        {
+            return { components[0], components[1], components[2] };
+        }
+
+        // Divides by w; directions (w = 0) are returned unscaled.
+        constexpr Vector3<T> ToCartesian() const noexcept requires (N == 4)
+        {
+            T w = components[3];
+            return (w != kZero<T>) ? ToVector3() / w : ToVector3();
+        }
+
+        bool IsNearlyEqual(const VectorN& other, T epsilon = kToleranceEpsilon<T>) const noexcept
+        {
+            return DistanceSquared(*this, other) < (epsilon * epsilon);
+        }
+
+        std::string ToString() const
+        {
+            return std::format("{}", *this);
+        }
+
+        // -------------------------
+        // Utilities
+        // -------------------------
+
+        static T Distance(const VectorN& a, const VectorN& b) noexcept
+        {
+            return (b - a).Length();
+        }
+
+        static constexpr T DistanceSquared(const VectorN& a, const VectorN& b) noexcept
+        {
+            return (b - a).LengthSquared();
+        }
+
+        static constexpr VectorN Reflect(const VectorN& v, const VectorN& n) noexcept
+        {
+            return v - n * (kTwo<T> * v.Dot(n));
+        }
+
+        static constexpr VectorN Lerp(const VectorN& a, const VectorN& b, T t) noexcept
+        {
+            // std::lerp branches per lane anyway, so the padding is left at zero rather than lerped.
+            VectorN result;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                result.components[i] = std::lerp(a.components[i], b.components[i], t);
+            }
+            return result;
+        }
+
+        static constexpr VectorN Min(const VectorN& a, const VectorN& b) noexcept
+        {
+            VectorN result;
+            for (std::size_t i = 0; i < kLanes; ++i)
+            {
+                result.components[i] = (b.components[i] < a.components[i]) ? b.components[i] : a.components[i];
+            }
+            return result;
+        }
+
+        static constexpr VectorN Max(const VectorN& a, const VectorN& b) noexcept
+        {
+            VectorN result;
+            for (std::size_t i = 0; i < kLanes; ++i)
+            {
+                result.components[i] = (a.components[i] < b.components[i]) ? b.components[i] : a.components[i];
+            }
+            return result;
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const VectorN& other) const noexcept = default;
+
+        constexpr VectorN operator+(const VectorN& other) const noexcept
+        {
+            VectorN result = *this;
+            result += other;
+            return result;
+        }
+
+        constexpr VectorN operator-(const VectorN& other) const noexcept
+        {
+            VectorN result = *this;
+            result -= other;
+            return result;
+        }
+
+        constexpr VectorN operator*(const VectorN& other) const noexcept
+        {
+            VectorN result;
+            for (std::size_t i = 0; i < kLanes; ++i)
+            {
+                result.components[i] = components[i] * other.components[i];
+            }
+            return result;
+        }
+
+        constexpr VectorN operator*(T scalar) const noexcept
+        {
+            VectorN result = *this;
+            result *= scalar;
+            return result;
+        }
+
+        constexpr VectorN operator/(T scalar) const noexcept
+        {
+            return *this * (kOne<T> / scalar);
+        }
+
+        constexpr VectorN operator-() const noexcept
+        {
+            VectorN result;
+            for (std::size_t i = 0; i < kLanes; ++i)
+            {
+                result.components[i] = -components[i];
+            }
+            return result;
+        }
+
+        constexpr VectorN& operator+=(const VectorN& other) noexcept
+        {
+            for (std::size_t i = 0; i < kLanes; ++i)
+            {
+                components[i] += other.components[i];
+            }
+            return *this;
+        }
+
+        constexpr VectorN& operator-=(const VectorN& other) noexcept
+        {
+            for (std::size_t i = 0; i < kLanes; ++i)
+            {
+                components[i] -= other.components[i];
+            }
+            return *this;
+        }
+
+        // Padding is re-zeroed rather than scaled, which would turn it into NaN for an infinite scalar.
+        constexpr VectorN& operator*=(T scalar) noexcept
+        {
+            for (std::size_t i = 0; i < kLanes; ++i)
+            {
+                components[i] *= scalar;
+            }
+            std::fill(components.begin() + N, components.end(), kZero<T>);
+            return *this;
+        }
+
+        constexpr VectorN& operator/=(T scalar) noexcept
+        {
+            *this *= kOne<T> / scalar;
+            return *this;
+        }
+
+        constexpr T& operator[](std::size_t index) noexcept
+        {
+            assert(index < N);
+            return components[index];
+        }
+
+        constexpr const T& operator[](std::size_t index) const noexcept
+        {
+            assert(index < N);
+            return components[index];
+        }
+
+        constexpr friend VectorN operator*(T scalar, const VectorN& v) noexcept
+        {
+            return v * scalar;
+        }
+    };
+
+    template<std::floating_point T>
+    using Vector4 = VectorN<T, 4>;
+
+    using FVector4 = Vector4<float>;
+    using DVector4 = Vector4<double>;
+    using LDVector4 = Vector4<long double>;
+}
+
+template<std::floating_point T, std::size_t N>
+struct std::formatter<Vec23::VectorN<T, N>> : std::formatter<T>
+{
+    template<typename FormatContext>
+    auto format(const Vec23::VectorN<T, N>& v, FormatContext& ctx) const
+    {
+        auto out = ctx.out();
+        *out++ = '(';
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            if (i > 0)
+            {
+                *out++ = ',';
+                *out++ = ' ';
+            }
+            ctx.advance_to(out);
+            out = std::formatter<T>::format(v.components[i], ctx);
+        }
+        *out++ = ')';
+        return out;
+    }
+};
@@ -0,0 +1,181 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <execution>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+#include "Constants.h"
+#include "Parallel.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    template<std::floating_point T>
+    struct VertexWeld
+    {
+        std::vector<Vector3<T>> vertices;
+        std::vector<std::uint32_t> remap;
+
+        static VertexWeld FromPoints(std::span<const Vector3<T>> points, T epsilon = kToleranceEpsilon<T>)
+        {
+            assert(points.size() < kNone);
+
+            const std::size_t count = points.size();
+            VertexWeld result;
+            result.remap.resize(count);
+
+            if (epsilon <= kZero<T>)
+            {
+                result.vertices.assign(points.begin(), points.end());
+                std::iota(result.remap.begin(), result.remap.end(), std::uint32_t(0));
+                return result;
+            }
+
+            const T invCellSize = kOne<T> / epsilon;
+            const T epsilonSq = epsilon * epsilon;
+            const std::uint64_t mask = std::bit_ceil(std::max<std::uint64_t>(count, 1)) - 1;
+
+            // Bucket every point by the hash of its quantized cell.
+            std::vector<std::uint32_t> buckets(count);
+            std::vector<std::uint32_t> offsets(mask + 2, 0);
+            Detail::ParallelFor(count, [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    Cell cell = CellOf(points[i], invCellSize);
+                    buckets[i] = static_cast<std::uint32_t>(Hash(cell.x, cell.y, cell.z) & mask);
+                    std::atomic_ref<std::uint32_t>(offsets[buckets[i] + 1]).fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+
+            std::inclusive_scan(std::execution::par, offsets.begin(), offsets.end(), offsets.begin());
+
+            std::vector<std::uint32_t> entries(count);
+            std::vector<std::uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+            Detail::ParallelFor(count, [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    std::uint32_t slot = std::atomic_ref<std::uint32_t>(cursors[buckets[i]]).fetch_add(1, std::memory_order_relaxed);
+                    entries[slot] = static_cast<std::uint32_t>(i);
+                }
+            });
+
+            auto findEarlier = [&](std::size_t i, auto&& accept) -> std::uint32_t
+            {
+                const Vector3<T>& p = points[i];
+                Cell cell = CellOf(p, invCellSize);
+                std::uint32_t best = kNone;
+                for (std::int64_t dx = -1; dx <= 1; ++dx)
+                {
+                    for (std::int64_t dy = -1; dy <= 1; ++dy)
+                    {
+                        for (std::int64_t dz = -1; dz <= 1; ++dz)
+                        {
+                            std::uint64_t bucket = Hash(cell.x + dx, cell.y + dy, cell.z + dz) & mask;
+                            for (std::uint32_t e = offsets[bucket]; e < offsets[bucket + 1]; ++e)
+                            {
+                                std::uint32_t j = entries[e];
+                                if (j < i && j < best && accept(j) &&
+                                    Vector3<T>::DistanceSquared(p, points[j]) < epsilonSq)
+                                {
+                                    best = j;
+                                }
+                            }
+                        }
+                    }
+                }
+                return best;
+            };
+
+            // The lowest earlier neighbor is the answer whenever it is itself a representative,
+            // which leaves only chained clusters for the sequential pass below.
+            std::vector<std::uint32_t> representatives(count);
+            Detail::ParallelFor(count, [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    representatives[i] = findEarlier(i, [](std::uint32_t) { return true; });
+                }
+            });
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::uint32_t candidate = representatives[i];
+                if (candidate != kNone && representatives[candidate] != candidate)
+                {
+                    candidate = findEarlier(i, [&](std::uint32_t j) { return representatives[j] == j; });
+                }
+
+                if (candidate == kNone)
+                {
+                    representatives[i] = static_cast<std::uint32_t>(i);
+                    result.remap[i] = static_cast<std::uint32_t>(result.vertices.size());
+                    result.vertices.push_back(points[i]);
+                }
+                else
+                {
+                    representatives[i] = candidate;
+                    result.remap[i] = result.remap[candidate];
+                }
+            }
+
+            return result;
+        }
+
+    private:
+        static constexpr std::uint32_t kNone = std::numeric_limits<std::uint32_t>::max();
+
+        struct Cell
+        {
+            std::int64_t x;
+            std::int64_t y;
+            std::int64_t z;
+        };
+
+        // Non-finite points share one cell outside the clamped range, where the neighbour offsets of +-1
+        // still cannot overflow. They never weld, since their distances are never below epsilon.
+        static constexpr std::int64_t kNonFiniteCell = std::numeric_limits<std::int64_t>::max() - 1;
+
+        static Cell CellOf(const Vector3<T>& p, T invCellSize) noexcept
+        {
+            if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z))
+            {
+                return { kNonFiniteCell, kNonFiniteCell, kNonFiniteCell };
+            }
+
+            return { CellCoordinate(p.x * invCellSize), CellCoordinate(p.y * invCellSize), CellCoordinate(p.z * invCellSize) };
+        }
+
+        // Clamped well inside the int64 range: tiny tolerances on large coordinates would otherwise overflow
+        // the conversion, and the products themselves may round to infinity.
+        static std::int64_t CellCoordinate(T scaled) noexcept
+        {
+            constexpr T kLimit = static_cast<T>(std::int64_t(1) << 62);
+            T cell = std::clamp(std::floor(scaled), -kLimit, kLimit);
+            return static_cast<std::int64_t>(cell);
+        }
+
+        static constexpr std::uint64_t Hash(std::int64_t x, std::int64_t y, std::int64_t z) noexcept
+        {
+            std::uint64_t h = static_cast<std::uint64_t>(x) * 0x9E3779B97F4A7C15ull;
+            h ^= static_cast<std::uint64_t>(y) * 0xC2B2AE3D27D4EB4Full;
+            h ^= static_cast<std::uint64_t>(z) * 0x165667B19E3779F9ull;
+            return h ^ (h >> 29);
+        }
+    };
+
+    using FVertexWeld = VertexWeld<float>;
+    using DVertexWeld = VertexWeld<double>;
+    using LDVertexWeld = VertexWeld<long double>;
+}
@@ -0,0 +1,158 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include "Parallel.h"
+#include "Vector3.h"
+
+namespace Vec23
+{
+    // Large-world position: a double-precision anchor (usually a grid cell corner) plus a float offset
+    // from it. Offsets stay small, so float math on them keeps sub-millimeter precision anywhere.
+    struct WorldPosition
+    {
+        static constexpr double kDefaultCellSize = 1024.0;
+
+        Vector3<double> anchor;
+        Vector3<float> offset;
+
+        constexpr WorldPosition() noexcept = default;
+
+        constexpr WorldPosition(const Vector3<double>& anchor, const Vector3<float>& offset) noexcept : anchor(anchor), offset(offset) {}
+
+        static WorldPosition FromDouble(const Vector3<double>& position, double cellSize = kDefaultCellSize) noexcept
+        {
+            assert(cellSize > 0.0);
+            Vector3<double> cell(
+                std::round(position.x / cellSize) * cellSize,
+                std::round(position.y / cellSize) * cellSize,
+                std::round(position.z / cellSize) * cellSize
+            );
+            return { cell, Narrow(position - cell) };
+        }
+
+        // -------------------------
+        // Modifiers
+        // -------------------------
+
+        // Re-expresses the same point relative to a new anchor.
+        void Rebase(const Vector3<double>& newAnchor) noexcept
+        {
+            offset += Narrow(anchor - newAnchor);
+            anchor = newAnchor;
+        }
+
+        // Moves whole cells out of the offset and into the anchor once the offset drifts past half a cell.
+        void Recenter(double cellSize = kDefaultCellSize) noexcept
+        {
+            float limit = static_cast<float>(cellSize * 0.5);
+            if (std::abs(offset.x) > limit || std::abs(offset.y) > limit || std::abs(offset.z) > limit)
+            {
+                *this = FromDouble(ToDouble(), cellSize);
+            }
+        }
+
+        // -------------------------
+        // Core
+        // -------------------------
+
+        Vector3<double> ToDouble() const noexcept
+        {
+            return anchor + Widen(offset);
+        }
+
+        // Float position relative to origin, e.g. a camera. Computed in double and rounded once.
+        Vector3<float> ToRelative(const Vector3<double>& origin) const noexcept
+        {
+            return Narrow((anchor - origin) + Widen(offset));
+        }
+
+        bool IsNearlyEqual(const WorldPosition& other, double epsilon = kToleranceEpsilon<double>) const noexcept
+        {
+            return ToDouble().IsNearlyEqual(other.ToDouble(), epsilon);
+        }
+
+        // -------------------------
+        // Utilities
+        // -------------------------
+
+        // Moves every position onto the cell grid centred at newAnchor. Each keeps its own cell anchor, so
+        // offsets stay within half a cell however far the entity is from the new origin.
+        static void Rebase(std::span<WorldPosition> positions, const Vector3<double>& newAnchor, double cellSize = kDefaultCellSize)
+        {
+            assert(cellSize > 0.0);
+            Detail::ParallelFor(positions.size(), [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    WorldPosition& position = positions[i];
+                    WorldPosition local = FromDouble((position.anchor - newAnchor) + Widen(position.offset), cellSize);
+                    position = { newAnchor + local.anchor, local.offset };
+                }
+            });
+        }
+
+        static void ToRelative(std::span<const WorldPosition> positions, const Vector3<double>& origin, std::span<Vector3<float>> out)
+        {
+            assert(out.size() >= positions.size());
+            Detail::ParallelFor(positions.size(), [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    out[i] = positions[i].ToRelative(origin);
+                }
+            });
+        }
+
+        // Floating origin for offsets that share one anchor: the shift is computed once in double and
+        // applied to every offset in float.
+        static void Rebase(std::span<Vector3<float>> offsets, const Vector3<double>& oldAnchor, const Vector3<double>& newAnchor)
+        {
+            Vector3<float> shift = Narrow(oldAnchor - newAnchor);
+            Detail::ParallelFor(offsets.size(), [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    offsets[i] += shift;
+                }
+            });
+        }
+
+        // -------------------------
+        // Operators
+        // -------------------------
+
+        constexpr bool operator==(const WorldPosition& other) const noexcept = default;
+
+        constexpr WorldPosition operator+(const Vector3<float>& delta) const noexcept
+        {
+            return { anchor, offset + delta };
+        }
+
+        constexpr WorldPosition& operator+=(const Vector3<float>& delta) noexcept
+        {
+            offset += delta;
+            return *this;
+        }
+
+        Vector3<double> operator-(const WorldPosition& other) const noexcept
+        {
+            return (anchor - other.anchor) + (Widen(offset) - Widen(other.offset));
+        }
+
+    private:
+        static constexpr Vector3<float> Narrow(const Vector3<double>& v) noexcept
+        {
+            return { static_cast<float>(v.x), static_cast<float>(v.y), static_cast<float>(v.z) };
+        }
+
+        static constexpr Vector3<double> Widen(const Vector3<float>& v) noexcept
+        {
+            return { v.x, v.y, v.z };
+        }
+    };
+}
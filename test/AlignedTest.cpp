@@ -0,0 +1,94 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <format>
+#include <limits>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(AlignedTest, Layout)
+    {
+        EXPECT_EQ(sizeof(FVector3A), 16u);
+        EXPECT_EQ(alignof(FVector3A), 16u);
+        EXPECT_EQ(sizeof(FQuaternionA), 16u);
+        EXPECT_EQ(alignof(FQuaternionA), 16u);
+        EXPECT_EQ(alignof(DVector3A), 32u);
+    }
+
+    TEST(AlignedTest, PaddingStaysZero)
+    {
+        FVector3A v = FVector3A(1.0f, 0.0f, 0.0f) * std::numeric_limits<float>::infinity();
+        v.x = 1.0f;
+        v.y = 2.0f;
+        v.z = 2.0f;
+        EXPECT_FLOAT_EQ(v.LengthSquared(), 9.0f);
+        EXPECT_EQ(v, FVector3A(1.0f, 2.0f, 2.0f));
+
+        v = FVector3A(1.0f, 2.0f, 3.0f) / 0.0f;
+        v.x = v.y = v.z = 0.0f;
+        EXPECT_EQ(v, FVector3A());
+    }
+
+    TEST(AlignedTest, QuaternionRoundTrip)
+    {
+        FQuaternion q = FQuaternion::FromEuler(10.0f, -35.0f, 120.0f);
+        FQuaternionA aligned(q);
+        EXPECT_EQ(aligned.ToQuaternion(), q);
+        EXPECT_TRUE(FQuaternionA::FromEuler(10.0f, -35.0f, 120.0f).IsNearlyEqual(aligned));
+        EXPECT_EQ(FQuaternionA(), FQuaternionA::Identity());
+        EXPECT_EQ(aligned.ToString(), q.ToString());
+    }
+
+    TEST(AlignedTest, QuaternionOperations)
+    {
+        FQuaternion a = FQuaternion::FromAxisAngle({ 1.0f, 2.0f, 3.0f }, 40.0f);
+        FQuaternion b = FQuaternion::FromEuler(-20.0f, 15.0f, 70.0f);
+        FQuaternionA aa(a);
+        FQuaternionA ba(b);
+
+        EXPECT_TRUE((aa * ba).ToQuaternion().IsNearlyEqual(a * b));
+        EXPECT_TRUE(aa.GetInversed().ToQuaternion().IsNearlyEqual(a.GetInversed()));
+        EXPECT_TRUE(aa.GetConjugated().ToQuaternion().IsNearlyEqual(a.GetConjugated()));
+        EXPECT_FLOAT_EQ(aa.Dot(ba), a.Dot(b));
+        EXPECT_TRUE((aa * 2.0f).GetNormalized().IsNearlyEqual(aa));
+
+        FVector3 v(3.0f, -1.0f, 0.5f);
+        EXPECT_TRUE(aa.RotateVector(FVector3A(v)).ToVector3().IsNearlyEqual(a.RotateVector(v)));
+        EXPECT_TRUE((aa * FVector3A(v)).ToVector3().IsNearlyEqual(a * v));
+    }
+
+    TEST(AlignedTest, VectorOperations)
+    {
+        FVector3 a(1.0f, -2.0f, 3.0f);
+        FVector3 b(0.5f, 4.0f, -1.0f);
+        FVector3A aa(a);
+        FVector3A ba(b);
+
+        EXPECT_EQ((aa + ba).ToVector3(), a + b);
+        EXPECT_EQ((aa - ba).ToVector3(), a - b);
+        EXPECT_EQ((aa * ba).ToVector3(), a * b);
+        EXPECT_EQ((aa * 2.0f).ToVector3(), a * 2.0f);
+        EXPECT_EQ((2.0f * aa).ToVector3(), 2.0f * a);
+        EXPECT_EQ((-aa).ToVector3(), -a);
+        EXPECT_EQ(aa.Cross(ba).ToVector3(), a.Cross(b));
+        EXPECT_FLOAT_EQ(aa.Dot(ba), a.Dot(b));
+        EXPECT_FLOAT_EQ(aa.Length(), a.Length());
+        EXPECT_TRUE(aa.GetNormalized().ToVector3().IsNearlyEqual(a.GetNormalized()));
+        EXPECT_TRUE(FVector3A::Reflect(aa, ba).ToVector3().IsNearlyEqual(FVector3::Reflect(a, b)));
+        EXPECT_TRUE(FVector3A::Lerp(aa, ba, 0.3f).ToVector3().IsNearlyEqual(FVector3::Lerp(a, b, 0.3f)));
+        EXPECT_FLOAT_EQ(aa[2], 3.0f);
+        EXPECT_EQ(std::format("{}", aa), std::format("{}", a));
+
+        aa += ba;
+        aa -= ba;
+        aa *= 3.0f;
+        aa /= 3.0f;
+        EXPECT_TRUE(aa.IsNearlyEqual(FVector3A(a)));
+
+        FVector3A zero;
+        zero.Normalize();
+        EXPECT_EQ(zero, FVector3A());
+    }
+}
@@ -0,0 +1,108 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    namespace
+    {
+        // Any allocation from the default resource while this is alive throws std::bad_alloc.
+        struct NoDefaultHeap
+        {
+            std::pmr::memory_resource* previous = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+            ~NoDefaultHeap()
+            {
+                std::pmr::set_default_resource(previous);
+            }
+        };
+    }
+
+    TEST(ArenaTest, Alignment)
+    {
+        FrameArena arena(1024);
+        static_cast<void>(arena.allocate(1, 1));
+        void* p = arena.allocate(64, 64);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, 0u);
+        EXPECT_LE(arena.Used(), 1024u);
+        EXPECT_EQ(arena.OverflowBytes(), 0u);
+    }
+
+    TEST(ArenaTest, BatchOpsStayInArena)
+    {
+        FrameArena arena(std::size_t(16) << 20);
+        constexpr std::size_t kCount = 100000;
+
+        DVector3SoA euler(kCount, &arena);
+        DQuaternionSoA rotations(&arena);
+        DVector3SoA roundTrip(&arena);
+        DVector3SoA combined(&arena);
+        {
+            NoDefaultHeap guard;
+            for (std::size_t i = 0; i < kCount; ++i)
+            {
+                euler.Set(i, { static_cast<double>(i % 360), 10.0, -20.0 });
+            }
+            DQuaternionSoA::FromEuler(euler, rotations);
+            rotations.ToEuler(roundTrip);
+            combined = euler * 2.0 - roundTrip;
+        }
+
+        EXPECT_EQ(arena.OverflowBytes(), 0u);
+        EXPECT_EQ(rotations.Resource(), &arena);
+        ASSERT_EQ(combined.Size(), kCount);
+        EXPECT_TRUE(combined.Get(45).IsNearlyEqual(DVector3(45.0, 10.0, -20.0), 1e-9));
+    }
+
+    TEST(ArenaTest, BumpAndReset)
+    {
+        FrameArena arena(256);
+        EXPECT_EQ(arena.Capacity(), 256u);
+
+        std::pmr::vector<float> values(&arena);
+        values.reserve(16);
+        EXPECT_EQ(arena.Used(), 16 * sizeof(float));
+
+        arena.Reset();
+        EXPECT_EQ(arena.Used(), 0u);
+        EXPECT_EQ(arena.HighWaterMark(), 16 * sizeof(float));
+    }
+
+    TEST(ArenaTest, Overflow)
+    {
+        FrameArena arena(64);
+        FVector3SoA points(&arena);
+        for (int i = 0; i < 100; ++i)
+        {
+            points.PushBack({ static_cast<float>(i), 0.0f, 0.0f });
+        }
+
+        EXPECT_GT(arena.OverflowBytes(), 0u);
+        EXPECT_EQ(points.Get(99), FVector3(99.0f, 0.0f, 0.0f));
+        EXPECT_GE(arena.HighWaterMark(), 3 * 100 * sizeof(float));
+
+        points = FVector3SoA();
+        arena.Reset();
+        EXPECT_EQ(arena.OverflowBytes(), 0u);
+    }
+
+    TEST(ArenaTest, PointCloudReduction)
+    {
+        FrameArena arena(4096);
+        std::vector<DVector3> points(50000, DVector3(1.0, 2.0, 3.0));
+
+        DVector3 centroid;
+        {
+            NoDefaultHeap guard;
+            centroid = DPointCloud::Centroid(points, &arena);
+        }
+        EXPECT_TRUE(centroid.IsNearlyEqual(DVector3(1.0, 2.0, 3.0)));
+        EXPECT_GT(arena.Used(), 0u);
+    }
+}
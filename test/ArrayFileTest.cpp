@@ -0,0 +1,127 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    static std::filesystem::path TempPath(const char* name)
+    {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    TEST(ArrayFileTest, AoSRoundTrip)
+    {
+        std::vector<FVector3> points;
+        for (int i = 0; i < 1000; ++i)
+        {
+            points.push_back({ i * 1.0f, i * 2.0f, i * -3.0f });
+        }
+
+        auto path = TempPath("Vec23ArrayFileAoS.bin");
+        ASSERT_TRUE(ArrayFile::Write(path, points));
+
+        MappedArrayFile file(path);
+        ASSERT_TRUE(file.IsOpen());
+        EXPECT_EQ(file.Header().element, ArrayElement::Vector3);
+        EXPECT_EQ(file.Header().precision, ArrayPrecision::Float);
+        EXPECT_EQ(file.Header().layout, ArrayLayout::AoS);
+        EXPECT_EQ(file.Header().count, points.size());
+
+        auto view = file.Vector3s<float>();
+        ASSERT_EQ(view.size(), points.size());
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.data()) % 64, 0u);
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            EXPECT_TRUE(view[i] == points[i]);
+        }
+
+        EXPECT_TRUE(file.Vector3s<double>().empty());
+        EXPECT_TRUE(file.Quaternions<float>().empty());
+        EXPECT_TRUE(file.Lane<float>(0).empty());
+
+        file.Close();
+        std::filesystem::remove(path);
+    }
+
+    TEST(ArrayFileTest, RejectsInvalidFiles)
+    {
+        auto path = TempPath("Vec23ArrayFileInvalid.bin");
+        {
+            std::ofstream stream(path, std::ios::binary);
+            stream << "not a vec23 array file, just some text that is long enough to hold a header";
+        }
+
+        MappedArrayFile file(path);
+        EXPECT_FALSE(file.IsOpen());
+        EXPECT_FALSE(file.Open(TempPath("Vec23ArrayFileMissing.bin")));
+        std::filesystem::remove(path);
+    }
+
+    TEST(ArrayFileTest, RejectsInvalidLaneStride)
+    {
+        std::vector<FVector3> points(100, FVector3(1.0f, 2.0f, 3.0f));
+        auto path = TempPath("Vec23ArrayFileStride.bin");
+
+        auto rewriteStride = [&](std::uint64_t stride)
+        {
+            ASSERT_TRUE(ArrayFile::Write(path, points, ArrayLayout::SoA));
+            std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+            stream.seekp(offsetof(ArrayFileHeader, laneStride));
+            stream.write(reinterpret_cast<const char*>(&stride), sizeof(stride));
+        };
+
+        // Small payload once multiplied out, but lane 1 would start 2^63 bytes past the data.
+        rewriteStride(std::uint64_t(1) << 63);
+        EXPECT_FALSE(MappedArrayFile(path).IsOpen());
+
+        rewriteStride(ArrayFileHeader::kAlignment * 7 + 8);
+        EXPECT_FALSE(MappedArrayFile(path).IsOpen());
+
+        rewriteStride(ArrayFileHeader::kAlignment * 7);
+        EXPECT_TRUE(MappedArrayFile(path).IsOpen());
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(ArrayFileTest, SoARoundTrip)
+    {
+        std::vector<DQuaternion> rotations;
+        for (int i = 0; i < 10; ++i)
+        {
+            rotations.push_back(DQuaternion::FromEuler(i * 10.0, i * 5.0, i * 2.0));
+        }
+
+        auto path = TempPath("Vec23ArrayFileSoA.bin");
+        ASSERT_TRUE(ArrayFile::Write(path, rotations, ArrayLayout::SoA));
+
+        MappedArrayFile file(path);
+        ASSERT_TRUE(file.IsOpen());
+        EXPECT_TRUE(file.Quaternions<double>().empty());
+
+        auto w = file.Lane<double>(0);
+        auto z = file.Lane<double>(3);
+        ASSERT_EQ(w.size(), rotations.size());
+        ASSERT_EQ(z.size(), rotations.size());
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(z.data()) % 64, 0u);
+        for (std::size_t i = 0; i < rotations.size(); ++i)
+        {
+            EXPECT_EQ(w[i], rotations[i].w);
+            EXPECT_EQ(z[i], rotations[i].z);
+        }
+        EXPECT_TRUE(file.Lane<double>(4).empty());
+
+        MappedArrayFile moved = std::move(file);
+        EXPECT_FALSE(file.IsOpen());
+        EXPECT_TRUE(moved.IsOpen());
+
+        moved.Close();
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,76 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(BoundingVolumeTest, OrientedBoxAlignsWithPointSet)
+    {
+        auto rotation = DQuaternion::FromEuler(30.0, 15.0, -40.0);
+        std::vector<DVector3> points;
+        for (int i = 0; i <= 20; ++i)
+        {
+            for (int j = 0; j <= 10; ++j)
+            {
+                for (int k = 0; k <= 4; ++k)
+                {
+                    points.push_back(rotation.RotateVector({ i * 0.5 - 5.0, j * 0.3 - 1.5, k * 0.25 - 0.5 }) + DVector3(1.0, 2.0, 3.0));
+                }
+            }
+        }
+
+        DOrientedBox box = DOrientedBox::FromPoints(points);
+        EXPECT_TRUE(box.center.IsNearlyEqual({ 1.0, 2.0, 3.0 }, 1e-6));
+        EXPECT_TRUE(box.extents.IsNearlyEqual({ 5.0, 1.5, 0.5 }, 1e-6));
+        EXPECT_NEAR(box.Volume(), 30.0, 1e-5);
+        for (const DVector3& p : points)
+        {
+            EXPECT_TRUE(box.Contains(p));
+        }
+        EXPECT_FALSE(box.Contains({ 1.0, 2.0, 10.0 }));
+    }
+
+    TEST(BoundingVolumeTest, OrientedBoxWithFrame)
+    {
+        std::vector<FVector3> points = { { -1.0f, -2.0f, -3.0f }, { 1.0f, 2.0f, 3.0f } };
+        FOrientedBox box = FOrientedBox::FromPoints(points, FQuaternion::Identity());
+        EXPECT_TRUE(box.center.IsNearlyEqual({ 0.0f, 0.0f, 0.0f }));
+        EXPECT_TRUE(box.extents.IsNearlyEqual({ 1.0f, 2.0f, 3.0f }));
+    }
+
+    TEST(BoundingVolumeTest, SphereContainsAllPoints)
+    {
+        std::vector<FVector3> points;
+        for (int i = 0; i < 100000; ++i)
+        {
+            float t = i * 0.001f;
+            points.push_back({ std::cos(t * 7.0f) * 3.0f, std::sin(t * 3.0f) * 2.0f, std::sin(t) * 5.0f });
+        }
+
+        FBoundingSphere sphere = FBoundingSphere::FromPoints(points);
+        for (const FVector3& p : points)
+        {
+            ASSERT_TRUE(sphere.Contains(p));
+        }
+        EXPECT_LT(sphere.radius, 5.0f * 1.2f);
+    }
+
+    TEST(BoundingVolumeTest, SphereEmpty)
+    {
+        std::vector<FVector3> points;
+        FBoundingSphere sphere = FBoundingSphere::FromPoints(points);
+        EXPECT_EQ(sphere.radius, 0.0f);
+    }
+
+    TEST(BoundingVolumeTest, SphereTwoPoints)
+    {
+        std::vector<DVector3> points = { { -2.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } };
+        DBoundingSphere sphere = DBoundingSphere::FromPoints(points);
+        EXPECT_TRUE(sphere.center.IsNearlyEqual({ 0.0, 0.0, 0.0 }));
+        EXPECT_NEAR(sphere.radius, 2.0, kToleranceEpsilon<double>);
+    }
+}
@@ -0,0 +1,120 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(ChangeDetectionTest, MatchesIsNearlyEqualQuaternion)
+    {
+        std::vector<DQuaternion> previous;
+        std::vector<DQuaternion> current;
+        for (int i = 0; i < 5000; ++i)
+        {
+            DQuaternion q = DQuaternion::FromEuler(i * 0.7, i * 0.3, -i * 0.11);
+            previous.push_back(q);
+            switch (i % 5)
+            {
+                case 0: current.push_back(q); break;
+                case 1: current.push_back(-q); break;
+                case 2: current.push_back(q * 3.0); break;
+                case 3: current.push_back(DQuaternion(0.0, 0.0, 0.0, 0.0)); break;
+                default: current.push_back(DQuaternion::FromEuler(i * 0.7 + 1.0, i * 0.3, -i * 0.11)); break;
+            }
+        }
+        previous[3] = DQuaternion(0.0, 0.0, 0.0, 0.0);
+
+        ChangeSet aos;
+        ChangeSet soa;
+        DChangeDetection::Compare(previous, current, aos);
+        DChangeDetection::Compare(DQuaternionSoA(previous), DQuaternionSoA(current), soa);
+
+        std::vector<std::uint32_t> expected;
+        for (std::size_t i = 0; i < previous.size(); ++i)
+        {
+            if (!previous[i].IsNearlyEqual(current[i]))
+            {
+                expected.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        ASSERT_EQ(aos.DirtyCount(), expected.size());
+        ASSERT_EQ(soa.DirtyCount(), expected.size());
+        for (std::size_t k = 0; k < expected.size(); ++k)
+        {
+            ASSERT_EQ(aos.Indices()[k], expected[k]);
+            ASSERT_EQ(soa.Indices()[k], expected[k]);
+        }
+        EXPECT_FALSE(aos.IsDirty(3));
+    }
+
+    TEST(ChangeDetectionTest, MatchesIsNearlyEqualVector3)
+    {
+        std::vector<FVector3> previous;
+        std::vector<FVector3> current;
+        for (int i = 0; i < 100003; ++i)
+        {
+            FVector3 p(static_cast<float>(i % 97), static_cast<float>(i % 13), -1.0f);
+            previous.push_back(p);
+            float shift = (i % 3 == 0) ? 1e-3f : ((i % 3 == 1) ? 1e-5f : 0.0f);
+            current.push_back(p + FVector3(shift, 0.0f, shift));
+        }
+
+        ChangeSet aos;
+        ChangeSet soa;
+        FChangeDetection::Compare(previous, current, aos);
+        FChangeDetection::Compare(FVector3SoA(previous), FVector3SoA(current), soa);
+        ASSERT_EQ(aos.Size(), previous.size());
+        ASSERT_EQ(aos.Words().size(), (previous.size() + 63) / 64);
+
+        std::size_t dirty = 0;
+        for (std::size_t i = 0; i < previous.size(); ++i)
+        {
+            bool changed = !previous[i].IsNearlyEqual(current[i]);
+            ASSERT_EQ(aos.IsDirty(i), changed) << i;
+            ASSERT_EQ(soa.IsDirty(i), changed) << i;
+            if (changed)
+            {
+                ASSERT_EQ(aos.Indices()[dirty], i);
+                ++dirty;
+            }
+        }
+        EXPECT_EQ(aos.DirtyCount(), dirty);
+        EXPECT_EQ(dirty, 33335u);
+    }
+
+    TEST(ChangeDetectionTest, PerElementTolerance)
+    {
+        std::vector<DVector3> previous(4, DVector3(1.0, 2.0, 3.0));
+        std::vector<DVector3> current(4, DVector3(1.0, 2.0, 3.5));
+        std::vector<double> epsilons = { 0.1, 1.0, 0.5, 0.6 };
+
+        ChangeSet changes;
+        DChangeDetection::Compare(previous, current, changes, epsilons);
+        ASSERT_EQ(changes.DirtyCount(), 2u);
+        EXPECT_EQ(changes.Indices()[0], 0u);
+        EXPECT_EQ(changes.Indices()[1], 2u);
+
+        DChangeDetection::Compare(DVector3SoA(previous), DVector3SoA(current), changes, epsilons);
+        ASSERT_EQ(changes.DirtyCount(), 2u);
+        EXPECT_EQ(changes.Words()[0], 0b0101u);
+    }
+
+    TEST(ChangeDetectionTest, Unchanged)
+    {
+        FVector3SoA positions;
+        ChangeSet changes;
+        FChangeDetection::Compare(positions, positions, changes);
+        EXPECT_EQ(changes.Size(), 0u);
+        EXPECT_EQ(changes.DirtyCount(), 0u);
+
+        positions.PushBack({ 1.0f, 2.0f, 3.0f });
+        FChangeDetection::Compare(positions, positions, changes);
+        EXPECT_EQ(changes.Size(), 1u);
+        EXPECT_FALSE(changes.IsDirty(0));
+    }
+}
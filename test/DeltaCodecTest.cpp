@@ -0,0 +1,140 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    static DVector3SoA Positions(std::size_t count, double time)
+    {
+        DVector3SoA positions;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            double phase = static_cast<double>(i) * 0.37;
+            positions.PushBack({ 50.0 * std::sin(phase) + time, 20.0 * std::cos(phase), static_cast<double>(i % 100) - time * 0.5 });
+        }
+        return positions;
+    }
+
+    TEST(DeltaCodecTest, DeltaFrame)
+    {
+        DVector3DeltaCodec codec(DVector3(-100.0, -100.0, -100.0), DVector3(100.0, 100.0, 100.0), 0.01);
+        QuantizedVector3SoA baseline;
+        QuantizedVector3SoA current;
+        codec.Quantize(Positions(1000, 0.0), baseline);
+        codec.Quantize(Positions(1000, 0.1), current);
+
+        std::vector<std::uint64_t> key;
+        std::vector<std::uint64_t> delta;
+        codec.Encode(current, {}, key);
+        codec.Encode(current, baseline, delta);
+        EXPECT_LT(delta.size() * 2, key.size());
+
+        QuantizedVector3SoA decoded;
+        ASSERT_TRUE(codec.Decode(delta, baseline, decoded));
+        EXPECT_EQ(decoded.x, current.x);
+        EXPECT_EQ(decoded.y, current.y);
+        EXPECT_EQ(decoded.z, current.z);
+
+        // Nothing moved: one header word, the block headers and the padding word.
+        std::vector<std::uint64_t> still;
+        codec.Encode(baseline, baseline, still);
+        EXPECT_EQ(still.size(), 2u + (16u * 18u + 63u) / 64u);
+        ASSERT_TRUE(codec.Decode(still, baseline, decoded));
+        EXPECT_EQ(decoded.x, baseline.x);
+    }
+
+    TEST(DeltaCodecTest, KeyFrameRoundTrip)
+    {
+        FVector3DeltaCodec codec(FVector3(-64.0f, -64.0f, -64.0f), FVector3(64.0f, 64.0f, 64.0f), 1.0f / 256.0f);
+        EXPECT_EQ(codec.Bits(), 16);
+
+        FVector3SoA positions;
+        for (int i = 0; i < 777; ++i)
+        {
+            positions.PushBack({ static_cast<float>(i % 120) - 60.0f + 0.001f * i, 0.013f * i, -0.05f * i });
+        }
+        positions.PushBack({ std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f });
+        positions.PushBack({ 500.0f, -500.0f, 0.0f });
+
+        QuantizedVector3SoA quantized;
+        codec.Quantize(positions, quantized);
+        std::vector<std::uint64_t> words;
+        codec.Encode(quantized, {}, words);
+
+        QuantizedVector3SoA decoded;
+        ASSERT_TRUE(codec.Decode(words, {}, decoded));
+        FVector3SoA restored;
+        codec.Dequantize(decoded, restored);
+        ASSERT_EQ(restored.Size(), positions.Size());
+        for (std::size_t i = 0; i + 2 < positions.Size(); ++i)
+        {
+            FVector3 error = restored.Get(i) - positions.Get(i);
+            ASSERT_LE(std::abs(error.x), codec.Precision() * 0.5f + 1e-5f) << i;
+            ASSERT_LE(std::abs(error.y), codec.Precision() * 0.5f + 1e-5f) << i;
+            ASSERT_LE(std::abs(error.z), codec.Precision() * 0.5f + 1e-5f) << i;
+        }
+        // NaN spreads to every axis through the frame transform, and each lands on cell 0.
+        EXPECT_EQ(restored.Get(positions.Size() - 2), FVector3(-64.0f, -64.0f, -64.0f));
+        EXPECT_EQ(restored.Get(positions.Size() - 1), FVector3(64.0f, -64.0f, 0.0f));
+    }
+
+    TEST(DeltaCodecTest, MalformedInput)
+    {
+        DVector3DeltaCodec codec(DVector3(0.0, 0.0, 0.0), DVector3(10.0, 10.0, 10.0), 0.001);
+        QuantizedVector3SoA baseline;
+        QuantizedVector3SoA current;
+        codec.Quantize(Positions(300, 0.0), baseline);
+        codec.Quantize(Positions(300, 1.0), current);
+
+        std::vector<std::uint64_t> words;
+        codec.Encode(current, baseline, words);
+
+        QuantizedVector3SoA decoded;
+        EXPECT_FALSE(codec.Decode(words, {}, decoded));
+        EXPECT_FALSE(codec.Decode(std::span(words).first(words.size() - 2), baseline, decoded));
+        EXPECT_FALSE(codec.Decode(std::span(words).first(1), baseline, decoded));
+
+        std::vector<std::uint64_t> wide = words;
+        wide[1] |= 63;
+        EXPECT_FALSE(codec.Decode(wide, baseline, decoded));
+
+        // A key-frame header claiming 2^32 - 1 elements with no blocks behind it.
+        std::vector<std::uint64_t> truncated = { 0xFFFFFFFFull, 0, 0 };
+        EXPECT_FALSE(codec.Decode(truncated, {}, decoded));
+        EXPECT_EQ(decoded.Size(), 300u);
+
+        QuantizedVector3SoA shorter;
+        codec.Quantize(Positions(299, 0.0), shorter);
+        EXPECT_FALSE(codec.Decode(words, shorter, decoded));
+        EXPECT_TRUE(codec.Decode(words, baseline, decoded));
+    }
+
+    TEST(DeltaCodecTest, ReferenceFrame)
+    {
+        DRigidTransform frame(DQuaternion::FromEuler(0.0, 0.0, 90.0), DVector3(1000.0, 0.0, 0.0));
+        DVector3DeltaCodec codec(DVector3(-10.0, -10.0, -10.0), DVector3(10.0, 10.0, 10.0), 0.001, frame);
+
+        DVector3SoA positions;
+        positions.PushBack(frame.TransformPoint(DVector3(1.0, 2.0, 3.0)));
+        positions.PushBack(frame.TransformPoint(DVector3(-9.5, 0.25, 9.999)));
+
+        QuantizedVector3SoA quantized;
+        codec.Quantize(positions, quantized);
+        EXPECT_EQ(quantized.x[0], 11000u);
+        EXPECT_EQ(quantized.y[0], 12000u);
+        EXPECT_EQ(quantized.z[0], 13000u);
+
+        DVector3SoA restored;
+        codec.Dequantize(quantized, restored);
+        EXPECT_TRUE(restored.Get(0).IsNearlyEqual(positions.Get(0), 1e-6));
+        EXPECT_TRUE(restored.Get(1).IsNearlyEqual(positions.Get(1), 1e-6));
+    }
+}
@@ -0,0 +1,96 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cstddef>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(ExpressionTest, AliasedOutput)
+    {
+        FVector3SoA a;
+        FVector3SoA b;
+        for (int i = 0; i < 1000; ++i)
+        {
+            a.PushBack({ static_cast<float>(i), 1.0f, -2.0f });
+            b.PushBack({ 0.5f, static_cast<float>(i), 4.0f });
+        }
+
+        a = a * 2.0f - b;
+        ASSERT_EQ(a.Size(), 1000u);
+        for (std::size_t i = 0; i < a.Size(); ++i)
+        {
+            float f = static_cast<float>(i);
+            ASSERT_EQ(a.Get(i), FVector3(2.0f * f - 0.5f, 2.0f - f, -8.0f));
+        }
+    }
+
+    TEST(ExpressionTest, Constructor)
+    {
+        DVector3SoA a;
+        a.PushBack({ 1.0, 2.0, 3.0 });
+        a.PushBack({ -1.0, 0.0, 4.0 });
+
+        DVector3SoA result = -a / 2.0;
+        ASSERT_EQ(result.Size(), 2u);
+        EXPECT_EQ(result.Get(0), DVector3(-0.5, -1.0, -1.5));
+        EXPECT_EQ(result.Get(1), DVector3(0.5, -0.0, -2.0));
+    }
+
+    TEST(ExpressionTest, FusedMatchesScalar)
+    {
+        FVector3SoA a;
+        FVector3SoA b;
+        FVector3SoA c;
+        FVector3SoA d;
+        for (int i = 0; i < 40000; ++i)
+        {
+            float f = static_cast<float>(i) * 0.0001f;
+            a.PushBack({ f, -f, 1.0f });
+            b.PushBack({ 1.0f, f, 0.5f * f });
+            c.PushBack({ -f, 2.0f, 3.0f });
+            d.PushBack({ 0.25f, f * f, -1.0f });
+        }
+
+        float s = 1.5f;
+        FVector3SoA out;
+        out = a * s + b.Cross(c) - d;
+        ASSERT_EQ(out.Size(), a.Size());
+
+        for (std::size_t i = 0; i < out.Size(); ++i)
+        {
+            FVector3 expected = a.Get(i) * s + b.Get(i).Cross(c.Get(i)) - d.Get(i);
+            ASSERT_TRUE(out.Get(i).IsNearlyEqual(expected));
+        }
+    }
+
+    TEST(ExpressionTest, Operators)
+    {
+        FVector3SoA a;
+        FVector3SoA b;
+        a.PushBack({ 1.0f, 2.0f, 3.0f });
+        b.PushBack({ 4.0f, 5.0f, 6.0f });
+
+        FVector3SoA out;
+        out = a + b;
+        EXPECT_EQ(out.Get(0), FVector3(5.0f, 7.0f, 9.0f));
+        out = a - b;
+        EXPECT_EQ(out.Get(0), FVector3(-3.0f, -3.0f, -3.0f));
+        out = a * b;
+        EXPECT_EQ(out.Get(0), FVector3(4.0f, 10.0f, 18.0f));
+        out = 2.0f * a;
+        EXPECT_EQ(out.Get(0), FVector3(2.0f, 4.0f, 6.0f));
+        out = (a + b).Cross(a - b);
+        EXPECT_EQ(out.Get(0), FVector3(5.0f, 7.0f, 9.0f).Cross(FVector3(-3.0f, -3.0f, -3.0f)));
+    }
+
+    // -------------------------
+    // Static Tests
+    // -------------------------
+
+    static_assert(Vector3Expression<FVector3SoA>);
+    static_assert(Vector3Expression<ScaleExpression<DVector3SoA>>);
+    static_assert(!Vector3Expression<FVector3>);
+    static_assert(!Vector3Expression<FQuaternionSoA>);
+}
@@ -0,0 +1,69 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(FixedQuaternionTest, AxisAngle)
+    {
+        Q32Quaternion q = Q32Quaternion::FromAxisAngle({ Q32_32(), Q32_32(2), Q32_32() }, Q32_32(60));
+        EXPECT_TRUE(q.IsNormalized());
+
+        Q32Vector3 axis;
+        Q32_32 degrees;
+        q.ToAxisAngle(axis, degrees);
+        EXPECT_TRUE(axis.IsNearlyEqual({ Q32_32(), Q32_32(1), Q32_32() }));
+        EXPECT_NEAR(degrees.ToFloat<double>(), 60.0, 1e-4);
+
+        EXPECT_EQ(Q32Quaternion::FromAxisAngle({}, Q32_32(60)), Q32Quaternion::Identity());
+    }
+
+    TEST(FixedQuaternionTest, Euler)
+    {
+        Q32Quaternion q = Q32Quaternion::FromEuler(Q32_32(10), Q32_32(20), Q32_32(30));
+        DQuaternion reference = DQuaternion::FromEuler(10.0, 20.0, 30.0);
+        EXPECT_NEAR(q.w.ToFloat<double>(), reference.w, 1e-6);
+        EXPECT_NEAR(q.x.ToFloat<double>(), reference.x, 1e-6);
+        EXPECT_NEAR(q.y.ToFloat<double>(), reference.y, 1e-6);
+        EXPECT_NEAR(q.z.ToFloat<double>(), reference.z, 1e-6);
+
+        Q32Vector3 euler = q.ToEuler();
+        EXPECT_NEAR(euler.x.ToFloat<double>(), 10.0, 1e-3);
+        EXPECT_NEAR(euler.y.ToFloat<double>(), 20.0, 1e-3);
+        EXPECT_NEAR(euler.z.ToFloat<double>(), 30.0, 1e-3);
+
+        Q32Vector3 gimbal = Q32Quaternion::FromEuler(Q32_32(), Q32_32(90), Q32_32(40)).ToEuler();
+        EXPECT_NEAR(gimbal.y.ToFloat<double>(), 90.0, 1e-9);
+        EXPECT_NEAR(gimbal.z.ToFloat<double>(), 40.0, 1e-3);
+    }
+
+    TEST(FixedQuaternionTest, Inverse)
+    {
+        Q16Quaternion q = Q16Quaternion::FromAxisAngle({ Q16_16(1), Q16_16(), Q16_16() }, Q16_16(45));
+        EXPECT_TRUE((q * q.GetInversed()).IsNearlyEqual(Q16Quaternion::Identity()));
+        EXPECT_TRUE((q * q.GetConjugated()).IsNearlyEqual(Q16Quaternion::Identity()));
+
+        Q16Quaternion zero(Q16_16(0), Q16_16(0), Q16_16(0), Q16_16(0));
+        EXPECT_EQ(zero.GetInversed(), Q16Quaternion::Identity());
+        EXPECT_EQ(zero.GetNormalized(), Q16Quaternion::Identity());
+    }
+
+    TEST(FixedQuaternionTest, RotateVector)
+    {
+        Q16Quaternion q = Q16Quaternion::FromAxisAngle({ Q16_16(), Q16_16(), Q16_16(1) }, Q16_16(90));
+        EXPECT_TRUE((q * Q16Vector3(Q16_16(1), Q16_16(), Q16_16())).IsNearlyEqual({ Q16_16(), Q16_16(1), Q16_16() }));
+    }
+
+    TEST(FixedQuaternionTest, Slerp)
+    {
+        Q32Quaternion a = Q32Quaternion::Identity();
+        Q32Quaternion b = Q32Quaternion::FromAxisAngle({ Q32_32(), Q32_32(), Q32_32(1) }, Q32_32(90));
+        Q32Quaternion mid = Q32Quaternion::Slerp(a, b, Q32_32(0.5));
+        EXPECT_TRUE(mid.IsNearlyEqual(Q32Quaternion::FromAxisAngle({ Q32_32(), Q32_32(), Q32_32(1) }, Q32_32(45))));
+        EXPECT_EQ(Q32Quaternion::Slerp(a, a, Q32_32(0.5)), a);
+        EXPECT_TRUE(Q32Quaternion::Slerp(a, -b, Q32_32(1)).IsNearlyEqual(b));
+        EXPECT_EQ(Q16Quaternion().ToString(), "(1, 0, 0, 0)");
+    }
+}
@@ -0,0 +1,107 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <numbers>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(FixedTest, Arithmetic)
+    {
+        Q16_16 a(1.5);
+        Q16_16 b(-0.25);
+        EXPECT_EQ(a.raw, 0x18000);
+        EXPECT_EQ((a + b).ToFloat<double>(), 1.25);
+        EXPECT_EQ((a - b).ToFloat<double>(), 1.75);
+        EXPECT_EQ((a * b).ToFloat<double>(), -0.375);
+        EXPECT_EQ((a / b).ToFloat<double>(), -6.0);
+        EXPECT_EQ(-a, Q16_16(-1.5));
+        EXPECT_TRUE(b < a);
+
+        Q32_32 c(1e6);
+        Q32_32 d(3.0);
+        EXPECT_NEAR((c / d).ToFloat<double>(), 1e6 / 3.0, 1e-9);
+        EXPECT_NEAR((c * Q32_32(1e-3)).ToFloat<double>(), 1e3, 2e-4);
+    }
+
+    TEST(FixedTest, DivideByZeroSaturates)
+    {
+        EXPECT_EQ((Q16_16(3) / Q16_16()).raw, INT32_MAX);
+        EXPECT_EQ((Q16_16(-3) / Q16_16()).raw, INT32_MIN);
+        EXPECT_EQ((Q32_32(3) / Q32_32()).raw, INT64_MAX);
+        EXPECT_EQ((Q32_32() / Q32_32()).raw, 0);
+    }
+
+    TEST(FixedTest, FloatConversionSaturates)
+    {
+        EXPECT_EQ(Q16_16(40000.0).raw, INT32_MAX);
+        EXPECT_EQ(Q16_16(-40000.0f).raw, INT32_MIN);
+        EXPECT_EQ(Q16_16(std::numeric_limits<double>::quiet_NaN()).raw, 0);
+        EXPECT_EQ(Q16_16(std::numeric_limits<float>::infinity()).raw, INT32_MAX);
+        EXPECT_EQ(Q32_32(-1e30).raw, INT64_MIN);
+        EXPECT_EQ(Q16_16(32767.99999).raw, INT32_MAX);
+        EXPECT_EQ(Q16_16(-32768.0).raw, INT32_MIN);
+        static_assert(Q16_16(1e10).raw == INT32_MAX);
+    }
+
+    TEST(FixedTest, Format)
+    {
+        EXPECT_EQ(Q16_16(2.5).ToString(), "2.5");
+        EXPECT_EQ(std::format("{:.2f}", Q32_32(-0.125)), "-0.12");
+    }
+
+    TEST(FixedTest, InverseTrig)
+    {
+        for (double v = -1.0; v <= 1.0; v += 0.0625)
+        {
+            EXPECT_NEAR(Q32_32::Asin(Q32_32(v)).ToFloat<double>(), std::asin(v) * 180.0 / std::numbers::pi, 1e-4);
+            EXPECT_NEAR(Q32_32::Acos(Q32_32(v)).ToFloat<double>(), std::acos(v) * 180.0 / std::numbers::pi, 1e-4);
+        }
+
+        const double points[][2] = { { 1.0, 0.0 }, { 1.0, 1.0 }, { 0.0, 1.0 }, { -3.0, 1.0 }, { -1.0, -2.0 }, { 0.5, -4.0 }, { 0.0, -1.0 } };
+        for (const auto& p : points)
+        {
+            double expected = std::atan2(p[1], p[0]) * 180.0 / std::numbers::pi;
+            EXPECT_NEAR(Q16_16::Atan2(Q16_16(p[1]), Q16_16(p[0])).ToFloat<double>(), expected, 2e-3);
+            EXPECT_NEAR(Q32_32::Atan2(Q32_32(p[1]), Q32_32(p[0])).ToFloat<double>(), expected, 1e-5);
+        }
+        EXPECT_EQ(Q32_32::Atan2(Q32_32(), Q32_32()), Q32_32());
+    }
+
+    TEST(FixedTest, Sqrt)
+    {
+        EXPECT_EQ(Q16_16::Sqrt(Q16_16(4)), Q16_16(2));
+        EXPECT_EQ(Q32_32::Sqrt(Q32_32(1)), Q32_32(1));
+        EXPECT_EQ(Q16_16::Sqrt(Q16_16(-1)), Q16_16());
+        EXPECT_NEAR(Q16_16::Sqrt(Q16_16(2)).ToFloat<double>(), std::sqrt(2.0), 2e-5);
+        EXPECT_NEAR(Q32_32::Sqrt(Q32_32(12345.678)).ToFloat<double>(), std::sqrt(12345.678), 1e-8);
+
+        // Exact floor of the root, identical on every platform.
+        Q32_32 root = Q32_32::Sqrt(Q32_32(2));
+        EXPECT_EQ(root.raw, INT64_C(6074000999));
+    }
+
+    TEST(FixedTest, Trig)
+    {
+        EXPECT_EQ(Q32_32::Sin(Q32_32(90)), Q32_32(1));
+        EXPECT_EQ(Q32_32::Cos(Q32_32()), Q32_32(1));
+        EXPECT_EQ(Q16_16::Sin(Q16_16(180)), Q16_16());
+        EXPECT_EQ(Q16_16::Sin(Q16_16(-90)), Q16_16(-1));
+
+        for (double degrees = -720.0; degrees <= 720.0; degrees += 7.3)
+        {
+            double radians = degrees * std::numbers::pi / 180.0;
+            EXPECT_NEAR(Q16_16::Sin(Q16_16(degrees)).ToFloat<double>(), std::sin(radians), 1e-4);
+            EXPECT_NEAR(Q32_32::Cos(Q32_32(degrees)).ToFloat<double>(), std::cos(radians), 1e-6);
+        }
+
+        // Adding the quarter turn before reducing would wrap these past the top of the Q16_16 range.
+        EXPECT_EQ(Q16_16::Cos(Q16_16(32760)), Q16_16::Cos(Q16_16(32760 % 360)));
+        EXPECT_EQ(Q16_16::Cos(Q16_16(-32760)), Q16_16::Cos(Q16_16(-32760 % 360)));
+    }
+}
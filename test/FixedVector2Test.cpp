@@ -0,0 +1,53 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(FixedVector2Test, Angle)
+    {
+        Q16Vector2 a(Q16_16(1), Q16_16());
+        Q16Vector2 b(Q16_16(), Q16_16(2));
+        EXPECT_NEAR(Q16Vector2::SignedAngle(a, b).ToFloat<double>(), 90.0, 1e-3);
+        EXPECT_NEAR(Q16Vector2::SignedAngle(b, a).ToFloat<double>(), -90.0, 1e-3);
+        EXPECT_NEAR(Q16Vector2::Angle(b, a).ToFloat<double>(), 90.0, 1e-3);
+    }
+
+    TEST(FixedVector2Test, Arithmetic)
+    {
+        Q16Vector2 a(Q16_16(1), Q16_16(2));
+        Q16Vector2 b(Q16_16(3), Q16_16(-4));
+        EXPECT_EQ(a + b, Q16Vector2(Q16_16(4), Q16_16(-2)));
+        EXPECT_EQ(a.Dot(b), Q16_16(-5));
+        EXPECT_EQ(a.Cross(b), Q16_16(-10));
+        EXPECT_EQ(b.Length(), Q16_16(5));
+        EXPECT_EQ(Q16Vector2::Lerp(a, b, Q16_16(0.5)), Q16Vector2(Q16_16(2), Q16_16(-1)));
+        EXPECT_EQ(a.ToString(), "(1, 2)");
+    }
+
+    TEST(FixedVector2Test, Normalize)
+    {
+        Q32Vector2 v(Q32_32(3), Q32_32(4));
+        v.Normalize();
+        EXPECT_TRUE(v.IsNormalized());
+        EXPECT_TRUE(v.IsNearlyEqual({ Q32_32(0.6), Q32_32(0.8) }));
+
+        Q32Vector2 zero;
+        zero.Normalize();
+        EXPECT_EQ(zero, Q32Vector2());
+    }
+
+    TEST(FixedVector2Test, Rotate)
+    {
+        Q32Vector2 v(Q32_32(1), Q32_32());
+        v.Rotate(Q32_32(90));
+        EXPECT_TRUE(v.IsNearlyEqual({ Q32_32(), Q32_32(1) }));
+
+        FVector2 reference = FVector2(2.0f, 1.0f).GetRotated(33.0f);
+        Q16Vector2 rotated = Q16Vector2(Q16_16(2), Q16_16(1)).GetRotated(Q16_16(33));
+        EXPECT_NEAR(rotated.x.ToFloat<float>(), reference.x, 1e-3f);
+        EXPECT_NEAR(rotated.y.ToFloat<float>(), reference.y, 1e-3f);
+    }
+}
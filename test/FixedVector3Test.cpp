@@ -0,0 +1,53 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(FixedVector3Test, Arithmetic)
+    {
+        Q32Vector3 a(Q32_32(1), Q32_32(2), Q32_32(3));
+        Q32Vector3 b(Q32_32(-2), Q32_32(0.5), Q32_32(4));
+        EXPECT_EQ(a - b, Q32Vector3(Q32_32(3), Q32_32(1.5), Q32_32(-1)));
+        EXPECT_EQ(a.Dot(b), Q32_32(11));
+        EXPECT_EQ(a.Cross(b), Q32Vector3(Q32_32(6.5), Q32_32(-10), Q32_32(4.5)));
+        EXPECT_EQ(a * Q32_32(2), Q32Vector3(Q32_32(2), Q32_32(4), Q32_32(6)));
+        EXPECT_EQ(Q32Vector3::DistanceSquared(a, b), Q32_32(9 + 2.25 + 1));
+        EXPECT_EQ(Q32Vector3::Reflect(a, { Q32_32(), Q32_32(), Q32_32(1) }), Q32Vector3(Q32_32(1), Q32_32(2), Q32_32(-3)));
+    }
+
+    TEST(FixedVector3Test, Deterministic)
+    {
+        // Raw results are pure integer arithmetic, so they can be compared bit for bit across machines.
+        Q16Vector3 v(Q16_16(1.25), Q16_16(-0.5), Q16_16(2));
+        Q16Vector3 rotated = v.GetRotated(Q16_16(37), { Q16_16(1), Q16_16(1), Q16_16() });
+        Q16Vector3 again = v.GetRotated(Q16_16(37), { Q16_16(1), Q16_16(1), Q16_16() });
+        EXPECT_EQ(rotated, again);
+
+        DVector3 reference = DVector3(1.25, -0.5, 2.0).GetRotated(37.0, { 1.0, 1.0, 0.0 });
+        EXPECT_NEAR(rotated.x.ToFloat<double>(), reference.x, 1e-3);
+        EXPECT_NEAR(rotated.y.ToFloat<double>(), reference.y, 1e-3);
+        EXPECT_NEAR(rotated.z.ToFloat<double>(), reference.z, 1e-3);
+    }
+
+    TEST(FixedVector3Test, Normalize)
+    {
+        Q16Vector3 v(Q16_16(2), Q16_16(3), Q16_16(6));
+        EXPECT_EQ(v.Length(), Q16_16(7));
+        v.Normalize();
+        EXPECT_TRUE(v.IsNormalized());
+        EXPECT_EQ(Q16Vector3().GetNormalized(), Q16Vector3());
+    }
+
+    TEST(FixedVector3Test, SignedAngle)
+    {
+        Q32Vector3 a(Q32_32(1), Q32_32(), Q32_32());
+        Q32Vector3 b(Q32_32(1), Q32_32(1), Q32_32());
+        Q32Vector3 up(Q32_32(), Q32_32(), Q32_32(1));
+        EXPECT_NEAR(Q32Vector3::Angle(a, b).ToFloat<double>(), 45.0, 1e-5);
+        EXPECT_NEAR(Q32Vector3::SignedAngle(b, a, up).ToFloat<double>(), -45.0, 1e-5);
+        EXPECT_EQ(a.ToString(), "(1, 0, 0)");
+    }
+}
@@ -0,0 +1,117 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    // Counts are only recorded when the library is built with VEC23_INSTRUMENTATION. Vec23Test runs these with
+    // the configured setting and Vec23InstrumentationTest always runs them with counting on.
+    static std::uint64_t Expected(std::uint64_t count)
+    {
+        return Instrumentation::kEnabled ? count : 0;
+    }
+
+    TEST(InstrumentationTest, AlignedNormalize)
+    {
+        Instrumentation::Reset();
+
+        FVector3A(3.0f, 4.0f, 0.0f).GetNormalized();
+        FVector3A().GetNormalized();
+        DQuaternionA(0.0, 0.0, 0.0, 0.0).GetNormalized();
+
+        CounterReport report = Instrumentation::Report();
+        EXPECT_EQ(report[Counter::Vector3Normalize], Expected(2));
+        EXPECT_EQ(report[Counter::Vector3NormalizeDegenerate], Expected(1));
+        EXPECT_EQ(report[Counter::QuaternionNormalize], Expected(1));
+        EXPECT_EQ(report[Counter::QuaternionNormalizeDegenerate], Expected(1));
+    }
+
+    TEST(InstrumentationTest, BatchToEuler)
+    {
+        DQuaternionSoA rotations;
+        for (int i = 0; i < 1000; ++i)
+        {
+            rotations.PushBack(DQuaternion::FromEuler(i * 0.1, i * 0.05, i * 0.2));
+        }
+        rotations.PushBack(DQuaternion::FromEuler(0.0, 90.0, 0.0));
+        rotations.PushBack(DQuaternion::FromEuler(0.0, 90.0, 0.0));
+        rotations.PushBack(DQuaternion::FromEuler(0.0, -90.0, 0.0));
+
+        Instrumentation::Reset();
+        DVector3SoA angles;
+        rotations.ToEuler(angles);
+
+        CounterReport report = Instrumentation::Report();
+        EXPECT_EQ(report[Counter::QuaternionToEuler], Expected(1003));
+        EXPECT_EQ(report[Counter::QuaternionToEulerGimbalNorth], Expected(2));
+        EXPECT_EQ(report[Counter::QuaternionToEulerGimbalSouth], Expected(1));
+    }
+
+    TEST(InstrumentationTest, CounterNames)
+    {
+        for (std::size_t i = 0; i < kCounterCount; ++i)
+        {
+            EXPECT_FALSE(CounterName(static_cast<Counter>(i)).empty());
+        }
+        EXPECT_TRUE(CounterName(Counter::Count).empty());
+    }
+
+    TEST(InstrumentationTest, DegenerateFallbacks)
+    {
+        Instrumentation::Reset();
+
+        DVector3 zero;
+        zero.Normalize();
+        FVector2(3.0f, 4.0f).GetNormalized();
+        DQuaternion(0.0, 0.0, 0.0, 0.0).GetInversed();
+        DQuaternion::Slerp(DQuaternion::Identity(), DQuaternion::FromEuler(0.0, 0.0, 90.0), 0.5);
+        DQuaternion::Slerp(DQuaternion::Identity(), DQuaternion::Identity(), 0.5);
+        DQuaternion::FromEuler(0.0, 90.0, 0.0).ToEuler();
+        DQuaternion::FromEuler(0.0, -90.0, 0.0).ToEuler();
+        DQuaternion::FromEuler(10.0, 20.0, 30.0).ToEuler();
+
+        CounterReport report = Instrumentation::Report();
+        EXPECT_EQ(report[Counter::Vector3Normalize], Expected(1));
+        EXPECT_EQ(report[Counter::Vector3NormalizeDegenerate], Expected(1));
+        EXPECT_EQ(report[Counter::Vector2Normalize], Expected(1));
+        EXPECT_EQ(report[Counter::Vector2NormalizeDegenerate], 0u);
+        EXPECT_EQ(report[Counter::QuaternionInverse], Expected(1));
+        EXPECT_EQ(report[Counter::QuaternionInverseDegenerate], Expected(1));
+        EXPECT_EQ(report[Counter::QuaternionSlerp], Expected(2));
+        EXPECT_EQ(report[Counter::QuaternionSlerpLerpFallback], Expected(1));
+        EXPECT_EQ(report[Counter::QuaternionToEuler], Expected(3));
+        EXPECT_EQ(report[Counter::QuaternionToEulerGimbalNorth], Expected(1));
+        EXPECT_EQ(report[Counter::QuaternionToEulerGimbalSouth], Expected(1));
+
+        std::string text = report.ToString();
+        EXPECT_EQ(text.find("Quaternion::Slerp (Lerp fallback): 1\n") != std::string::npos, Instrumentation::kEnabled);
+
+        Instrumentation::Reset();
+        EXPECT_EQ(Instrumentation::Report()[Counter::QuaternionSlerp], 0u);
+    }
+
+    TEST(InstrumentationTest, ThreadsAreMerged)
+    {
+        Instrumentation::Reset();
+
+        std::thread worker([]
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                FQuaternion(1.0f, 2.0f, 3.0f, 4.0f).GetNormalized();
+            }
+        });
+        worker.join();
+        FQuaternion(0.0f, 0.0f, 0.0f, 0.0f).GetNormalized();
+
+        CounterReport report = Instrumentation::Report();
+        EXPECT_EQ(report[Counter::QuaternionNormalize], Expected(1001));
+        EXPECT_EQ(report[Counter::QuaternionNormalizeDegenerate], Expected(1));
+    }
+}
@@ -0,0 +1,124 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cstddef>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(InterpolationTest, BatchMatchesSingle)
+    {
+        constexpr std::size_t kEntities = 40000;
+        DInterpolationBuffer buffer(kEntities, 4, 0.1);
+        for (std::size_t e = 0; e < kEntities; ++e)
+        {
+            // Every 11th entity stays empty and every 13th has a single snapshot.
+            int snapshots = (e % 11 == 0) ? 0 : (e % 13 == 0) ? 1 : 6;
+            double offset = static_cast<double>(e % 7) * 0.01;
+            for (int k = 0; k < snapshots; ++k)
+            {
+                double time = offset + k * 0.05;
+                buffer.Push(e, time, DVector3(time, static_cast<double>(e), -time), DQuaternion::FromEuler(0.0, 0.0, time * 100.0 + e % 5));
+            }
+        }
+
+        // Before every ring, inside them, and past the newest snapshot of most.
+        for (double time : { -1.0, 0.2, 0.33 })
+        {
+            DVector3SoA positions;
+            DQuaternionSoA rotations;
+            buffer.Sample(time, positions, rotations);
+            ASSERT_EQ(positions.Size(), kEntities);
+            ASSERT_EQ(rotations.Size(), kEntities);
+
+            for (std::size_t e = 0; e < kEntities; ++e)
+            {
+                DVector3 position;
+                DQuaternion rotation;
+                buffer.Sample(e, time, position, rotation);
+                ASSERT_EQ(positions.Get(e), position) << e;
+                ASSERT_TRUE(rotations.Get(e).IsNearlyEqual(rotation, 1e-12)) << e;
+            }
+        }
+    }
+
+    TEST(InterpolationTest, Empty)
+    {
+        FInterpolationBuffer buffer(2, 3);
+        FVector3 position(1.0f, 1.0f, 1.0f);
+        FQuaternion rotation(0.0f, 1.0f, 0.0f, 0.0f);
+        EXPECT_FALSE(buffer.Sample(0, 1.0f, position, rotation));
+        EXPECT_EQ(position, FVector3());
+        EXPECT_EQ(rotation, FQuaternion::Identity());
+        EXPECT_EQ(buffer.SnapshotCount(1), 0u);
+    }
+
+    TEST(InterpolationTest, Extrapolation)
+    {
+        DInterpolationBuffer buffer(1, 4, 0.5);
+        buffer.Push(0, 0.0, DVector3(0.0, 0.0, 0.0), DQuaternion::FromAxisAngle(DVector3(0.0, 0.0, 1.0), 0.0));
+        buffer.Push(0, 1.0, DVector3(1.0, 0.0, 0.0), DQuaternion::FromAxisAngle(DVector3(0.0, 0.0, 1.0), 20.0));
+
+        DVector3 position;
+        DQuaternion rotation;
+        buffer.Sample(0, 1.25, position, rotation);
+        EXPECT_TRUE(position.IsNearlyEqual(DVector3(1.25, 0.0, 0.0)));
+        EXPECT_TRUE(rotation.IsNearlyEqual(DQuaternion::FromAxisAngle(DVector3(0.0, 0.0, 1.0), 25.0), 1e-9));
+
+        buffer.Sample(0, 3.0, position, rotation);
+        EXPECT_TRUE(position.IsNearlyEqual(DVector3(1.5, 0.0, 0.0)));
+        EXPECT_TRUE(rotation.IsNearlyEqual(DQuaternion::FromAxisAngle(DVector3(0.0, 0.0, 1.0), 30.0), 1e-9));
+
+        // A limit longer than the snapshot interval keeps rotation in step with position.
+        buffer.SetExtrapolationLimit(2.0);
+        buffer.Sample(0, 3.0, position, rotation);
+        EXPECT_TRUE(position.IsNearlyEqual(DVector3(3.0, 0.0, 0.0)));
+        EXPECT_TRUE(rotation.IsNearlyEqual(DQuaternion::FromAxisAngle(DVector3(0.0, 0.0, 1.0), 60.0), 1e-9));
+
+        buffer.SetExtrapolationLimit(0.0);
+        buffer.Sample(0, 3.0, position, rotation);
+        EXPECT_TRUE(position.IsNearlyEqual(DVector3(1.0, 0.0, 0.0)));
+    }
+
+    TEST(InterpolationTest, Interpolation)
+    {
+        FInterpolationBuffer buffer(1, 3);
+        FQuaternion start = FQuaternion::FromEuler(0.0f, 0.0f, 0.0f);
+        FQuaternion end = FQuaternion::FromEuler(0.0f, 0.0f, 90.0f);
+        EXPECT_TRUE(buffer.Push(0, 1.0f, FVector3(0.0f, 0.0f, 0.0f), start));
+        EXPECT_TRUE(buffer.Push(0, 2.0f, FVector3(10.0f, 0.0f, 0.0f), end));
+        EXPECT_FALSE(buffer.Push(0, 2.0f, FVector3(), start));
+
+        FVector3 position;
+        FQuaternion rotation;
+        ASSERT_TRUE(buffer.Sample(0, 1.25f, position, rotation));
+        EXPECT_TRUE(position.IsNearlyEqual(FVector3::Lerp(FVector3(), FVector3(10.0f, 0.0f, 0.0f), 0.25f)));
+        EXPECT_TRUE(rotation.IsNearlyEqual(FQuaternion::Slerp(start, end, 0.25f)));
+
+        buffer.Sample(0, 0.0f, position, rotation);
+        EXPECT_EQ(position, FVector3());
+    }
+
+    TEST(InterpolationTest, RingWraps)
+    {
+        FInterpolationBuffer buffer(1, 2);
+        for (int k = 0; k < 5; ++k)
+        {
+            buffer.Push(0, static_cast<float>(k), FVector3(static_cast<float>(k), 0.0f, 0.0f), FQuaternion::Identity());
+        }
+        EXPECT_EQ(buffer.SnapshotCount(0), 2u);
+
+        FVector3 position;
+        FQuaternion rotation;
+        buffer.Sample(0, 3.5f, position, rotation);
+        EXPECT_TRUE(position.IsNearlyEqual(FVector3(3.5f, 0.0f, 0.0f)));
+
+        // Older than the oldest retained snapshot (t = 3): holds it.
+        buffer.Sample(0, 1.0f, position, rotation);
+        EXPECT_EQ(position, FVector3(3.0f, 0.0f, 0.0f));
+
+        buffer.Clear();
+        EXPECT_FALSE(buffer.Sample(0, 1.0f, position, rotation));
+    }
+}
@@ -0,0 +1,69 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(PointCloudTest, Centroid)
+    {
+        std::vector<FVector3> points = { { 1.0f, 2.0f, 3.0f }, { 3.0f, 4.0f, 5.0f } };
+        EXPECT_TRUE(FPointCloud::Centroid(points).IsNearlyEqual({ 2.0f, 3.0f, 4.0f }));
+    }
+
+    TEST(PointCloudTest, CentroidCompensated)
+    {
+        std::vector<FVector3> points(1'000'000, FVector3(0.1f, 1000.1f, -7.3f));
+        FVector3 centroid = FPointCloud::Centroid(points);
+        EXPECT_NEAR(centroid.x, 0.1f, 1e-6f);
+        EXPECT_NEAR(centroid.y, 1000.1f, 1e-3f);
+        EXPECT_NEAR(centroid.z, -7.3f, 1e-6f);
+    }
+
+    TEST(PointCloudTest, Covariance)
+    {
+        std::vector<DVector3> points = { { -1.0, 0.0, 2.0 }, { 1.0, 0.0, 2.0 }, { 0.0, -2.0, 2.0 }, { 0.0, 2.0, 2.0 } };
+        DCovariance3 covariance = DPointCloud::Covariance(points);
+        EXPECT_NEAR(covariance.xx, 0.5, kToleranceEpsilon<double>);
+        EXPECT_NEAR(covariance.yy, 2.0, kToleranceEpsilon<double>);
+        EXPECT_NEAR(covariance.zz, 0.0, kToleranceEpsilon<double>);
+        EXPECT_NEAR(covariance.xy, 0.0, kToleranceEpsilon<double>);
+    }
+
+    TEST(PointCloudTest, Empty)
+    {
+        std::vector<FVector3> points;
+        EXPECT_TRUE(FPointCloud::Centroid(points) == FVector3());
+        EXPECT_TRUE(FPointCloud::Covariance(points) == FCovariance3());
+    }
+
+    TEST(PointCloudTest, PrincipalAxes)
+    {
+        auto rotation = DQuaternion::FromEuler(20.0, -35.0, 60.0);
+        std::vector<DVector3> points;
+        for (int i = -50; i <= 50; ++i)
+        {
+            for (int j = -10; j <= 10; ++j)
+            {
+                points.push_back(rotation.RotateVector({ i * 0.4, j * 0.3, std::sin(i * 1.0 + j) * 0.1 }) + DVector3(5.0, 6.0, 7.0));
+            }
+        }
+
+        DQuaternion frame;
+        DVector3 variances;
+        DPointCloud::Covariance(points).ToPrincipalAxes(frame, variances);
+        EXPECT_GT(variances.x, variances.y);
+        EXPECT_GT(variances.y, variances.z);
+        EXPECT_TRUE(frame.IsNormalized());
+
+        DVector3 major = frame.RotateVector({ 1.0, 0.0, 0.0 });
+        DVector3 expected = rotation.RotateVector({ 1.0, 0.0, 0.0 });
+        EXPECT_NEAR(std::abs(major.Dot(expected)), 1.0, 1e-6);
+
+        DVector3 minor = DPointCloud::PrincipalAxes(points).RotateVector({ 0.0, 0.0, 1.0 });
+        EXPECT_NEAR(std::abs(minor.Dot(rotation.RotateVector({ 0.0, 0.0, 1.0 }))), 1.0, 1e-3);
+    }
+}
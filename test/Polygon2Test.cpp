@@ -0,0 +1,85 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(Polygon2Test, ContainsBatch)
+    {
+        std::vector<DVector2> polygon = { { 0.0, 0.0 }, { 2.0, 0.0 }, { 2.0, 2.0 }, { 0.0, 2.0 } };
+        std::vector<DVector2> points;
+        for (int i = 0; i < 50000; ++i)
+        {
+            points.push_back({ std::fmod(i * 0.37, 3.0) - 0.4567, std::fmod(i * 0.91, 3.0) - 0.4321 });
+        }
+
+        std::vector<std::uint8_t> inside(points.size());
+        DPolygon2::Contains(polygon, points, inside);
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            bool expected = points[i].x > 0.0 && points[i].x < 2.0 && points[i].y > 0.0 && points[i].y < 2.0;
+            EXPECT_EQ(inside[i] != 0, expected);
+        }
+    }
+
+    TEST(Polygon2Test, ContainsConcave)
+    {
+        std::vector<FVector2> polygon = { { 0.0f, 0.0f }, { 4.0f, 0.0f }, { 4.0f, 4.0f }, { 2.0f, 1.0f }, { 0.0f, 4.0f } };
+        EXPECT_TRUE(FPolygon2::Contains(polygon, { 1.0f, 0.5f }));
+        EXPECT_TRUE(FPolygon2::Contains(polygon, { 3.5f, 3.0f }));
+        EXPECT_FALSE(FPolygon2::Contains(polygon, { 2.0f, 3.0f }));
+        EXPECT_FALSE(FPolygon2::Contains(polygon, { 5.0f, 1.0f }));
+    }
+
+    TEST(Polygon2Test, HullDegenerate)
+    {
+        std::vector<FVector2> single = { { 1.0f, 1.0f }, { 1.0f, 1.0f } };
+        EXPECT_EQ(FConvexHull2::MonotoneChain(single).size(), 1u);
+        EXPECT_EQ(FConvexHull2::Quickhull(single).size(), 1u);
+
+        std::vector<FVector2> line = { { 0.0f, 0.0f }, { 1.0f, 1.0f }, { 2.0f, 2.0f } };
+        EXPECT_EQ(FConvexHull2::MonotoneChain(line).size(), 2u);
+        EXPECT_EQ(FConvexHull2::Quickhull(line).size(), 2u);
+    }
+
+    TEST(Polygon2Test, HullMethodsAgree)
+    {
+        std::vector<DVector2> points;
+        for (int i = 0; i < 100000; ++i)
+        {
+            double angle = i * 0.61803398875;
+            double radius = std::fmod(i * 0.7548776662, 1.0);
+            points.push_back({ std::cos(angle) * radius * 3.0, std::sin(angle) * radius });
+        }
+
+        std::vector<DVector2> chain = DConvexHull2::MonotoneChain(points);
+        std::vector<DVector2> quick = DConvexHull2::Quickhull(points);
+        ASSERT_EQ(chain.size(), quick.size());
+        for (std::size_t i = 0; i < chain.size(); ++i)
+        {
+            EXPECT_TRUE(chain[i] == quick[i]);
+        }
+
+        for (std::size_t i = 0; i < chain.size(); ++i)
+        {
+            const DVector2& next = chain[(i + 1) % chain.size()];
+            EXPECT_GT(DPolygon2::Orientation(chain[i], next, chain[(i + 2) % chain.size()]), 0.0);
+        }
+    }
+
+    TEST(Polygon2Test, HullSquare)
+    {
+        std::vector<FVector2> points = { { 0.5f, 0.5f }, { 0.0f, 0.0f }, { 1.0f, 1.0f }, { 1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.5f, 0.0f } };
+        std::vector<FVector2> hull = FConvexHull2::MonotoneChain(points);
+        ASSERT_EQ(hull.size(), 4u);
+        EXPECT_TRUE(hull[0] == FVector2(0.0f, 0.0f));
+        EXPECT_TRUE(hull[1] == FVector2(1.0f, 0.0f));
+        EXPECT_TRUE(hull[2] == FVector2(1.0f, 1.0f));
+        EXPECT_TRUE(hull[3] == FVector2(0.0f, 1.0f));
+    }
+}
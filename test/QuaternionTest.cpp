@@ -1,6 +1,9 @@
 /// Copyright (c) 2026 Jose Ilitzky
 
 #include <gtest/gtest.h>
+#include <format>
+#include <iterator>
+#include <string>
 
 import Vec23;
 
@@ -35,6 +38,29 @@ namespace Vec23::Test
         EXPECT_TRUE(q == q);
     }
 
+    TEST(QuaternionTest, Format)
+    {
+        FQuaternion q(1.0f, 0.0f, -0.5f, 2.0f);
+        EXPECT_EQ(q.ToString(), "(1, 0, -0.5, 2)");
+        EXPECT_EQ(std::format("{:.1f}", q), "(1.0, 0.0, -0.5, 2.0)");
+
+        std::string out;
+        std::format_to(std::back_inserter(out), "{}", q);
+        EXPECT_EQ(out, "(1, 0, -0.5, 2)");
+    }
+
+    TEST(QuaternionTest, FromAxes)
+    {
+        auto q = FQuaternion::FromAxisAngle({ 1.0f, 2.0f, 3.0f }, 70.0f);
+        FVector3 xAxis = q.RotateVector({ 1.0f, 0.0f, 0.0f });
+        FVector3 yAxis = q.RotateVector({ 0.0f, 1.0f, 0.0f });
+        FVector3 zAxis = q.RotateVector({ 0.0f, 0.0f, 1.0f });
+        EXPECT_TRUE(FQuaternion::FromAxes(xAxis, yAxis, zAxis).IsNearlyEqual(q));
+
+        auto flip = FQuaternion::FromAxes({ -1.0f, 0.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f });
+        EXPECT_TRUE(flip.IsNearlyEqual({ 0.0f, 0.0f, 0.0f, 1.0f }));
+    }
+
     TEST(QuaternionTest, FromAxisAngle)
     {
         FVector3 axis(0.0f, 1.0f, 0.0f);
@@ -42,6 +68,14 @@ namespace Vec23::Test
         EXPECT_TRUE(q.IsNearlyEqual({ 0.707106781f, 0.0f, 0.707106781f, 0.0f }));
     }
 
+    TEST(QuaternionTest, FromAxisAngleUnitAxis)
+    {
+        FVector3 axis(1.0f, 2.0f, 2.0f);
+        auto q = FQuaternion::FromAxisAngle(FUnitVector3(axis), 75.0f);
+        EXPECT_TRUE(q.IsNormalized());
+        EXPECT_TRUE(q.IsNearlyEqual(FQuaternion::FromAxisAngle(axis, 75.0f)));
+    }
+
     TEST(QuaternionTest, FromEulerCombined)
     {
         auto q = FQuaternion::FromEuler(45.0f, 45.0f, 45.0f);
@@ -200,6 +234,27 @@ namespace Vec23::Test
         EXPECT_NEAR(result.z, 45.0f, kToleranceEpsilon<float>);
     }
 
+    TEST(QuaternionTest, UnitQuaternion)
+    {
+        FUnitQuaternion q(FQuaternion(2.0f, 0.0f, 2.0f, 0.0f));
+        EXPECT_TRUE(q.Get().IsNormalized());
+        EXPECT_TRUE(q.IsNearlyEqual(FUnitQuaternion::FromAxisAngle(FUnitVector3::UnitY(), 90.0f)));
+
+        FUnitQuaternion degenerate(FQuaternion(0.0f, 0.0f, 0.0f, 0.0f));
+        EXPECT_EQ(degenerate, FUnitQuaternion::Identity());
+
+        EXPECT_TRUE(q.GetInversed().Get().IsNearlyEqual(q.Get().GetInversed()));
+        EXPECT_TRUE((q * q.GetInversed()).IsNearlyEqual(FUnitQuaternion::Identity()));
+
+        FUnitVector3 rotated = q.RotateVector(FUnitVector3::UnitX());
+        EXPECT_TRUE(rotated.Get().IsNearlyEqual({ 0.0f, 0.0f, -1.0f }));
+        EXPECT_TRUE((q * FVector3(1.0f, 0.0f, 0.0f)).IsNearlyEqual({ 0.0f, 0.0f, -1.0f }));
+
+        auto half = FUnitQuaternion::Slerp(FUnitQuaternion::Identity(), q, 0.5f);
+        EXPECT_TRUE(half.IsNearlyEqual(FUnitQuaternion::FromAxisAngle(FUnitVector3::UnitY(), 45.0f)));
+        EXPECT_TRUE(half.Get().IsNormalized());
+    }
+
     TEST(QuaternionTest, Usage)
     {
         // Compute the dot product of two 2D vectors.
@@ -0,0 +1,64 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(RigidTransformTest, Composition)
+    {
+        DRigidTransform a(DQuaternion::FromAxisAngle({ 0.0, 1.0, 0.0 }, 90.0), { 1.0, 0.0, 0.0 });
+        DRigidTransform b(DQuaternion::FromAxisAngle({ 1.0, 0.0, 0.0 }, 30.0), { 0.0, 2.0, 0.0 });
+        DVector3 p(1.0, 2.0, 3.0);
+        EXPECT_TRUE((a * b).TransformPoint(p).IsNearlyEqual(a.TransformPoint(b.TransformPoint(p))));
+        EXPECT_TRUE(a.GetInversed().TransformPoint(a * p).IsNearlyEqual(p));
+    }
+
+    TEST(RigidTransformTest, FromCorrespondences)
+    {
+        DRigidTransform expected(DQuaternion::FromEuler(10.0, 140.0, -75.0), { 3.0, -2.0, 0.5 });
+        std::vector<DVector3> source;
+        std::vector<DVector3> target;
+        for (int i = 0; i < 1000; ++i)
+        {
+            DVector3 p(std::sin(i * 0.7) * 4.0, std::cos(i * 1.3) * 2.0, (i % 17) * 0.25);
+            source.push_back(p);
+            target.push_back(expected * p);
+        }
+
+        DRigidTransform result = DRigidTransform::FromCorrespondences(source, target);
+        EXPECT_TRUE(result.rotation.IsNearlyEqual(expected.rotation));
+        EXPECT_TRUE(result.translation.IsNearlyEqual(expected.translation));
+    }
+
+    TEST(RigidTransformTest, FromCorrespondencesIdentity)
+    {
+        std::vector<FVector3> points = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+        FRigidTransform result = FRigidTransform::FromCorrespondences(points, points);
+        EXPECT_TRUE(result.rotation.IsNearlyEqual(FQuaternion::Identity()));
+        EXPECT_TRUE(result.translation.IsNearlyEqual({ 0.0f, 0.0f, 0.0f }));
+    }
+
+    TEST(RigidTransformTest, IterativeClosestPoint)
+    {
+        DRigidTransform expected(DQuaternion::FromEuler(4.0, -3.0, 6.0), { 0.05, -0.1, 0.02 });
+        std::vector<DVector3> source;
+        std::vector<DVector3> target;
+        for (int i = 0; i < 40; ++i)
+        {
+            for (int j = 0; j < 40; ++j)
+            {
+                DVector3 p(i * 0.05, j * 0.05, std::sin(i * 0.2) * std::cos(j * 0.3));
+                source.push_back(p);
+                target.push_back(expected * p);
+            }
+        }
+
+        DRigidTransform result = DRigidTransform::IterativeClosestPoint(source, target, 100, 1e-14);
+        EXPECT_TRUE(result.rotation.IsNearlyEqual(expected.rotation, 1e-8));
+        EXPECT_TRUE(result.translation.IsNearlyEqual(expected.translation, 1e-4));
+    }
+}
@@ -0,0 +1,89 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(RotationTest, AxisRotation3Apply)
+    {
+        FVector3 axis(1.0f, 2.0f, -0.5f);
+        FAxisRotation3 rotation(37.0f, axis);
+        FVector3 v(3.0f, -1.0f, 2.0f);
+        EXPECT_TRUE(rotation.Apply(v).IsNearlyEqual(v.GetRotated(37.0f, axis)));
+        EXPECT_TRUE((rotation * v).IsNearlyEqual(v.GetRotated(37.0f, axis)));
+        EXPECT_TRUE(rotation.GetInversed().Apply(rotation.Apply(v)).IsNearlyEqual(v));
+        EXPECT_NEAR(rotation.Degrees(), 37.0f, kToleranceEpsilon<float>);
+        EXPECT_TRUE(rotation.ToQuaternion().RotateVector(v).IsNearlyEqual(rotation.Apply(v)));
+    }
+
+    TEST(RotationTest, AxisRotation3Batch)
+    {
+        std::vector<DVector3> points;
+        for (int i = 0; i < 40000; ++i)
+        {
+            points.emplace_back(i * 0.001, 1.0 - i * 0.002, 0.5);
+        }
+
+        DAxisRotation3 rotation(120.0, DUnitVector3::UnitZ());
+        std::vector<DVector3> rotated(points.size());
+        rotation.Apply(std::span<const DVector3>(points), rotated);
+        rotation.Apply(points);
+
+        for (std::size_t i = 0; i < points.size(); i += 997)
+        {
+            DVector3 expected = DVector3(i * 0.001, 1.0 - i * 0.002, 0.5).GetRotated(120.0, DVector3(0.0, 0.0, 1.0));
+            EXPECT_TRUE(points[i].IsNearlyEqual(expected));
+            EXPECT_EQ(points[i], rotated[i]);
+        }
+    }
+
+    TEST(RotationTest, AxisRotation3DegenerateAxis)
+    {
+        FAxisRotation3 rotation(90.0f, FVector3(0.0f, 0.0f, 0.0f));
+        EXPECT_EQ(rotation.Axis(), FUnitVector3::UnitX());
+        EXPECT_TRUE(FAxisRotation3::Identity().Apply({ 1.0f, 2.0f, 3.0f }).IsNearlyEqual({ 1.0f, 2.0f, 3.0f }));
+    }
+
+    TEST(RotationTest, Rotation2Apply)
+    {
+        FRotation2 rotation(90.0f);
+        EXPECT_TRUE(rotation.Apply({ 1.0f, 0.0f }).IsNearlyEqual({ 0.0f, 1.0f }));
+        EXPECT_TRUE((rotation * FVector2(0.0f, 1.0f)).IsNearlyEqual({ -1.0f, 0.0f }));
+
+        FVector2 v(3.0f, -2.0f);
+        EXPECT_TRUE(FRotation2(33.0f).Apply(v).IsNearlyEqual(v.GetRotated(33.0f)));
+        EXPECT_NEAR(FRotation2(-135.0f).Degrees(), -135.0f, kToleranceEpsilon<float>);
+    }
+
+    TEST(RotationTest, Rotation2Batch)
+    {
+        std::vector<FVector2> polyline;
+        for (int i = 0; i < 50000; ++i)
+        {
+            polyline.emplace_back(static_cast<float>(i % 100), static_cast<float>(i / 100));
+        }
+
+        std::vector<FVector2> original = polyline;
+        FRotation2 rotation(-60.0f);
+        rotation.Apply(polyline);
+
+        for (std::size_t i = 0; i < polyline.size(); i += 1009)
+        {
+            EXPECT_TRUE(polyline[i].IsNearlyEqual(original[i].GetRotated(-60.0f), 1e-3f));
+        }
+    }
+
+    TEST(RotationTest, Rotation2Compose)
+    {
+        FRotation2 a(30.0f);
+        FRotation2 b(45.0f);
+        EXPECT_TRUE((a * b).IsNearlyEqual(FRotation2(75.0f)));
+        EXPECT_TRUE((a * a.GetInversed()).IsNearlyEqual(FRotation2::Identity()));
+        EXPECT_EQ(FRotation2(), FRotation2::Identity());
+    }
+}
@@ -0,0 +1,96 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(SnapshotStoreTest, ConcurrentFramesAreConsistent)
+    {
+        constexpr std::size_t kSize = 4096;
+        constexpr std::uint64_t kFrames = 20000;
+        FQuaternionStore store(kSize);
+
+        std::thread producer([&]
+        {
+            for (std::uint64_t frame = 1; frame <= kFrames; ++frame)
+            {
+                float value = static_cast<float>(frame);
+                for (FQuaternion& q : store.Write())
+                {
+                    q = FQuaternion(value, value, value, value);
+                }
+                store.Publish();
+            }
+        });
+
+        std::uint64_t last = 0;
+        bool consistent = true;
+        while (last < kFrames && consistent)
+        {
+            if (!store.Refresh())
+            {
+                continue;
+            }
+
+            std::uint64_t frame = store.FrameNumber();
+            consistent = frame > last;
+            last = frame;
+
+            float expected = static_cast<float>(frame);
+            for (const FQuaternion& q : store.Read())
+            {
+                consistent = consistent && q == FQuaternion(expected, expected, expected, expected);
+            }
+        }
+        producer.join();
+
+        EXPECT_TRUE(consistent);
+        EXPECT_EQ(last, kFrames);
+    }
+
+    TEST(SnapshotStoreTest, LatestFrameWins)
+    {
+        FVector3Store store;
+        EXPECT_FALSE(store.Refresh());
+        EXPECT_EQ(store.FrameNumber(), 0u);
+        EXPECT_TRUE(store.Read().empty());
+
+        std::vector<FVector3> first = { { 1.0f, 2.0f, 3.0f } };
+        std::vector<FVector3> second = { { 4.0f, 5.0f, 6.0f }, { 7.0f, 8.0f, 9.0f } };
+        store.Publish(first);
+        store.Publish(second);
+
+        EXPECT_TRUE(store.Refresh());
+        EXPECT_EQ(store.FrameNumber(), 2u);
+        ASSERT_EQ(store.Read().size(), 2u);
+        EXPECT_EQ(store.Read()[1], FVector3(7.0f, 8.0f, 9.0f));
+        EXPECT_FALSE(store.Refresh());
+    }
+
+    TEST(SnapshotStoreTest, WriteInPlace)
+    {
+        DVector3Store store(3);
+        EXPECT_EQ(store.Read().size(), 3u);
+
+        std::span<DVector3> back = store.Write();
+        ASSERT_EQ(back.size(), 3u);
+        back[0] = DVector3(1.0, 0.0, 0.0);
+        back[2] = DVector3(0.0, 0.0, 1.0);
+        store.Publish();
+
+        store.Resize(1);
+        store.Write()[0] = DVector3(0.0, 1.0, 0.0);
+        store.Publish();
+
+        ASSERT_TRUE(store.Refresh());
+        ASSERT_EQ(store.Read().size(), 1u);
+        EXPECT_EQ(store.Read()[0], DVector3(0.0, 1.0, 0.0));
+    }
+}
@@ -0,0 +1,120 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(SoATest, FromEuler)
+    {
+        DVector3SoA euler;
+        for (int i = 0; i < 50000; ++i)
+        {
+            euler.PushBack({ std::fmod(i * 7.3, 720.0) - 360.0, std::fmod(i * 1.9, 180.0) - 90.0, -i * 0.013 });
+        }
+
+        DQuaternionSoA rotations;
+        DQuaternionSoA::FromEuler(euler, rotations);
+        ASSERT_EQ(rotations.Size(), euler.Size());
+
+        for (std::size_t i = 0; i < euler.Size(); ++i)
+        {
+            DVector3 angles = euler.Get(i);
+            DQuaternion expected = DQuaternion::FromEuler(angles.x, angles.y, angles.z);
+            DQuaternion result = rotations.Get(i);
+            ASSERT_NEAR(result.w, expected.w, 1e-14);
+            ASSERT_NEAR(result.x, expected.x, 1e-14);
+            ASSERT_NEAR(result.y, expected.y, 1e-14);
+            ASSERT_NEAR(result.z, expected.z, 1e-14);
+        }
+
+        // Non-finite angles come out as NaN, and angles far past int32 quadrants still reduce exactly.
+        DVector3SoA unusual;
+        unusual.PushBack({ std::numeric_limits<double>::quiet_NaN(), 0.0, 0.0 });
+        unusual.PushBack({ 0.0, std::numeric_limits<double>::infinity(), 0.0 });
+        unusual.PushBack({ 0.0, 0.0, 1e300 });
+        unusual.PushBack({ 360.0 * 1e12 + 90.0, 0.0, 0.0 });
+        DQuaternionSoA::FromEuler(unusual, rotations);
+        EXPECT_TRUE(std::isnan(rotations.w[0]));
+        EXPECT_TRUE(std::isnan(rotations.w[1]));
+        EXPECT_TRUE(std::isfinite(rotations.w[2]));
+        EXPECT_NEAR(rotations.Get(2).LengthSquared(), 1.0, 1e-12);
+        EXPECT_TRUE(rotations.Get(3).IsNearlyEqual(DQuaternion::FromEuler(90.0, 0.0, 0.0), 1e-12));
+    }
+
+    TEST(SoATest, FromAoS)
+    {
+        std::vector<FVector3> points = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+        FVector3SoA soa(points);
+        ASSERT_EQ(soa.Size(), 2u);
+        EXPECT_EQ(soa.x[1], 4.0f);
+        EXPECT_EQ(soa.y[0], 2.0f);
+        EXPECT_EQ(soa.z[1], 6.0f);
+        EXPECT_EQ(soa.ToAoS(), points);
+    }
+
+    TEST(SoATest, FromAoSQuaternion)
+    {
+        std::vector<FQuaternion> rotations = { FQuaternion::Identity(), { 0.0f, 1.0f, 0.0f, 0.0f } };
+        FQuaternionSoA soa(rotations);
+        ASSERT_EQ(soa.Size(), 2u);
+        EXPECT_EQ(soa.w[0], 1.0f);
+        EXPECT_EQ(soa.x[1], 1.0f);
+        EXPECT_EQ(soa.ToAoS(), rotations);
+
+        soa.Clear();
+        EXPECT_TRUE(soa.IsEmpty());
+    }
+
+    TEST(SoATest, Modifiers)
+    {
+        DVector3SoA soa;
+        EXPECT_TRUE(soa.IsEmpty());
+
+        soa.PushBack({ 1.0, 2.0, 3.0 });
+        soa.Resize(3);
+        soa.Set(2, { 7.0, 8.0, 9.0 });
+        EXPECT_EQ(soa.Get(0), DVector3(1.0, 2.0, 3.0));
+        EXPECT_EQ(soa.Get(1), DVector3());
+        EXPECT_EQ(soa.Get(2), DVector3(7.0, 8.0, 9.0));
+
+        soa.Clear();
+        EXPECT_EQ(soa.Size(), 0u);
+    }
+
+    TEST(SoATest, ToEuler)
+    {
+        FQuaternionSoA rotations;
+        for (int i = 0; i < 40000; ++i)
+        {
+            float t = static_cast<float>(i);
+            rotations.PushBack(FQuaternion::FromEuler(std::fmod(t * 3.1f, 340.0f) - 170.0f, std::fmod(t * 0.7f, 170.0f) - 85.0f, std::fmod(t * 5.3f, 340.0f) - 170.0f));
+        }
+        rotations.PushBack(FQuaternion::FromEuler(0.0f, 90.0f, 45.0f));
+        rotations.PushBack(FQuaternion::FromEuler(0.0f, -90.0f, 30.0f));
+        rotations.PushBack({ 1.0f, 0.0f, 0.0f, 0.0f });
+        rotations.PushBack({ 0.0f, 0.0f, 0.0f, 1.0f });
+
+        FVector3SoA euler;
+        rotations.ToEuler(euler);
+        ASSERT_EQ(euler.Size(), rotations.Size());
+
+        for (std::size_t i = 0; i < rotations.Size(); ++i)
+        {
+            FVector3 expected = rotations.Get(i).ToEuler();
+            FVector3 result = euler.Get(i);
+            ASSERT_NEAR(result.x, expected.x, 1e-3f) << i;
+            ASSERT_NEAR(result.y, expected.y, 1e-3f) << i;
+            ASSERT_NEAR(result.z, expected.z, 1e-3f) << i;
+        }
+
+        EXPECT_NEAR(euler.Get(rotations.Size() - 4).y, 90.0f, kToleranceEpsilon<float>);
+        EXPECT_NEAR(euler.Get(rotations.Size() - 4).z, 45.0f, kToleranceEpsilon<float>);
+        EXPECT_NEAR(euler.Get(rotations.Size() - 3).y, -90.0f, kToleranceEpsilon<float>);
+    }
+}
@@ -0,0 +1,88 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    struct Vertex
+    {
+        float uv[2];
+        float position[3];
+        std::uint32_t color;
+    };
+
+    static std::vector<Vertex> MakeVertices(int count)
+    {
+        std::vector<Vertex> vertices(count);
+        for (int i = 0; i < count; ++i)
+        {
+            vertices[i] = { { 0.5f, 0.25f }, { i * 1.0f, i * 2.0f, i * -1.0f }, 0xFFFFFFFFu };
+        }
+        return vertices;
+    }
+
+    TEST(StridedViewTest, BatchOpsMatchCopies)
+    {
+        std::vector<Vertex> vertices = MakeVertices(40000);
+        ConstVector3View<float> view(std::span<const Vertex>(vertices), offsetof(Vertex, position));
+
+        std::vector<FVector3> copies(view.begin(), view.end());
+        EXPECT_EQ(FPointCloud::Centroid(view), FPointCloud::Centroid(copies));
+        EXPECT_TRUE(FPointCloud::Covariance(view) == FPointCloud::Covariance(copies));
+
+        FBoundingSphere sphere = FBoundingSphere::FromPoints(view);
+        EXPECT_EQ(sphere.center, FBoundingSphere::FromPoints(copies).center);
+        EXPECT_TRUE(std::ranges::all_of(view, [&](const FVector3& p) { return sphere.Contains(p, 1e-3f); }));
+
+        FOrientedBox box = FOrientedBox::FromPoints(view, FQuaternion::Identity());
+        EXPECT_TRUE(box.extents.IsNearlyEqual(FOrientedBox::FromPoints(copies, FQuaternion::Identity()).extents));
+    }
+
+    TEST(StridedViewTest, Iterator)
+    {
+        static_assert(std::ranges::random_access_range<FVector3View>);
+        static_assert(std::ranges::sized_range<ConstVector3View<double>>);
+
+        std::vector<Vertex> vertices = MakeVertices(5);
+        FVector3View view(std::span<Vertex>(vertices), offsetof(Vertex, position));
+        EXPECT_EQ(view.size(), 5u);
+        EXPECT_EQ(view.Stride(), sizeof(Vertex));
+        EXPECT_FALSE(view.IsContiguous());
+        EXPECT_EQ(view.end() - view.begin(), 5);
+        EXPECT_EQ(view.begin()[3], FVector3(3.0f, 6.0f, -3.0f));
+        EXPECT_EQ(*(view.end() - 1), FVector3(4.0f, 8.0f, -4.0f));
+        EXPECT_EQ(view.Subview(1, 2)[1], FVector3(2.0f, 4.0f, -2.0f));
+        EXPECT_TRUE(view.begin() < view.end());
+    }
+
+    TEST(StridedViewTest, WriteThrough)
+    {
+        std::vector<Vertex> vertices = MakeVertices(100);
+        FVector3View view(std::span<Vertex>(vertices), offsetof(Vertex, position));
+
+        FRigidTransform transform(FQuaternion::Identity(), { 10.0f, 0.0f, 0.0f });
+        transform.TransformPoints(view);
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(vertices[i].position[0], i + 10.0f);
+            EXPECT_EQ(vertices[i].position[1], i * 2.0f);
+            EXPECT_EQ(vertices[i].uv[1], 0.25f);
+            EXPECT_EQ(vertices[i].color, 0xFFFFFFFFu);
+        }
+
+        std::vector<FVector3> points = { { 1.0f, 2.0f, 3.0f } };
+        FVector3View contiguous{ std::span<FVector3>(points) };
+        EXPECT_TRUE(contiguous.IsContiguous());
+        contiguous[0] = FVector3(4.0f, 5.0f, 6.0f);
+        EXPECT_EQ(points[0], FVector3(4.0f, 5.0f, 6.0f));
+    }
+}
@@ -0,0 +1,129 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(TextFormatTest, AppendMatchesToString)
+    {
+        std::vector<DVector3> points = { { 0.1, 0.2, 0.3 }, { -1e-20, 1e20, 5.0 } };
+        std::string out;
+        TextFormat::Append(out, points);
+        EXPECT_EQ(out, points[0].ToString() + "\n" + points[1].ToString() + "\n");
+    }
+
+    TEST(TextFormatTest, BufferTooSmall)
+    {
+        std::vector<FVector3> points = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+        char buffer[16];
+        auto result = TextFormat::ToChars(buffer, buffer + sizeof(buffer), points);
+        EXPECT_EQ(result.ec, std::errc::value_too_large);
+    }
+
+    TEST(TextFormatTest, ParseFile)
+    {
+        auto path = std::filesystem::temp_directory_path() / "Vec23TextFormatParse.obj";
+        {
+            std::ofstream stream(path);
+            stream << "# cube corner\nv 1 2 3\nvn 0 0 1\nv -1.5 0.25 4e2\nf 1 2 3\n";
+        }
+
+        std::vector<DVector3> points;
+        ASSERT_TRUE(TextFormat::ParseFile(path, points, TextDialect::OBJ));
+        ASSERT_EQ(points.size(), 2u);
+        EXPECT_EQ(points[0], DVector3(1.0, 2.0, 3.0));
+        EXPECT_EQ(points[1], DVector3(-1.5, 0.25, 400.0));
+
+        EXPECT_FALSE(TextFormat::ParseFile(std::filesystem::temp_directory_path() / "Vec23TextFormatMissing.obj", points));
+        std::filesystem::remove(path);
+    }
+
+    TEST(TextFormatTest, ParseLarge)
+    {
+        std::vector<FVector3> points;
+        for (int i = 0; i < 200000; ++i)
+        {
+            points.push_back({ i * 0.5f, -i * 0.25f, i * 1e-3f });
+        }
+
+        std::string text;
+        TextFormat::Append(text, points);
+
+        FVector3SoA parsed;
+        ASSERT_TRUE(TextFormat::Parse(text, parsed));
+        ASSERT_EQ(parsed.Size(), points.size());
+        EXPECT_EQ(parsed.ToAoS(), points);
+    }
+
+    TEST(TextFormatTest, ParseMalformed)
+    {
+        std::vector<DVector3> points = { { 1.0, 1.0, 1.0 } };
+        EXPECT_FALSE(TextFormat::Parse("1 2 3\n4 five 6\n", points));
+        ASSERT_EQ(points.size(), 1u);
+        EXPECT_FALSE(TextFormat::Parse("1 2\n", points));
+        EXPECT_EQ(points.size(), 1u);
+    }
+
+    TEST(TextFormatTest, ParseXYZ)
+    {
+        std::vector<DVector3> points;
+        ASSERT_TRUE(TextFormat::Parse("# header\n1 2 3\r\n\n  4,5,6\n(0.5, -7, 1e-3)\n8\t9\t10 255 0 0", points));
+        ASSERT_EQ(points.size(), 4u);
+        EXPECT_EQ(points[0], DVector3(1.0, 2.0, 3.0));
+        EXPECT_EQ(points[1], DVector3(4.0, 5.0, 6.0));
+        EXPECT_EQ(points[2], DVector3(0.5, -7.0, 1e-3));
+        EXPECT_EQ(points[3], DVector3(8.0, 9.0, 10.0));
+    }
+
+    TEST(TextFormatTest, ToChars)
+    {
+        char buffer[TextFormat::kMaxItemChars];
+        auto result = TextFormat::ToChars(buffer, buffer + sizeof(buffer), FQuaternion(1.0f, 0.0f, -0.5f, 2.0f));
+        ASSERT_EQ(result.ec, std::errc());
+        EXPECT_EQ(std::string(buffer, result.ptr), "(1, 0, -0.5, 2)");
+
+        LDVector3 extreme(-std::numeric_limits<long double>::denorm_min(), std::numeric_limits<long double>::max(), -1.0L / 3.0L);
+        result = TextFormat::ToChars(buffer, buffer + sizeof(buffer), extreme);
+        EXPECT_EQ(result.ec, std::errc());
+    }
+
+    TEST(TextFormatTest, ToCharsBatch)
+    {
+        std::vector<FVector2> points = { { 1.0f, 2.0f }, { 3.5f, -4.0f } };
+        char buffer[2 * (TextFormat::kMaxItemChars + 1)];
+        auto result = TextFormat::ToChars(buffer, buffer + sizeof(buffer), points, ';');
+        ASSERT_EQ(result.ec, std::errc());
+        EXPECT_EQ(std::string(buffer, result.ptr), "(1, 2);(3.5, -4);");
+    }
+
+    TEST(TextFormatTest, ToCharsLongest)
+    {
+        // Negative, full-precision mantissas with the widest exponents the type has.
+        long double tiny = -std::numeric_limits<long double>::denorm_min() * 3.0L;
+        long double third = -1.0L / 3.0L;
+        long double large = -std::numeric_limits<long double>::max() / 3.0L;
+        std::vector<LDQuaternion> rotations = { LDQuaternion(tiny, large, third * 1e-300L, third), LDQuaternion(third, third, third, third) };
+
+        char buffer[TextFormat::kMaxItemChars];
+        for (const LDQuaternion& q : rotations)
+        {
+            auto result = TextFormat::ToChars(buffer, buffer + TextFormat::MaxItemChars<long double>(4), q);
+            EXPECT_EQ(result.ec, std::errc());
+        }
+
+        std::string out;
+        ASSERT_TRUE(TextFormat::Append(out, rotations));
+        EXPECT_EQ(std::count(out.begin(), out.end(), '\n'), 2);
+        EXPECT_LE(TextFormat::MaxItemChars<float>(3), TextFormat::kMaxItemChars);
+    }
+}
@@ -0,0 +1,150 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    static std::span<const std::byte> Bytes(const std::string& data)
+    {
+        return { reinterpret_cast<const std::byte*>(data.data()), data.size() };
+    }
+
+    TEST(TrajectoryTest, InvalidData)
+    {
+        std::string data = "not a trajectory stream, but long enough to read a header and a footer from";
+        TrajectoryReader<FVector3> reader(Bytes(data));
+        EXPECT_FALSE(reader.IsValid());
+        EXPECT_EQ(reader.SampleCount(), 0u);
+
+        std::ostringstream stream;
+        TrajectoryWriter<FVector3> writer(stream, 0.001);
+        writer.Append({ 1.0f, 2.0f, 3.0f });
+        ASSERT_TRUE(writer.Finish());
+        std::string valid = stream.str();
+        EXPECT_TRUE(TrajectoryReader<FVector3>(Bytes(valid)).IsValid());
+        EXPECT_FALSE(TrajectoryReader<DVector3>(Bytes(valid)).IsValid());
+        EXPECT_FALSE(TrajectoryReader<FQuaternion>(Bytes(valid)).IsValid());
+    }
+
+    TEST(TrajectoryTest, InvalidChunk)
+    {
+        std::ostringstream stream;
+        TrajectoryWriter<FVector3> writer(stream, 0.001, 16);
+        for (int i = 0; i < 16; ++i)
+        {
+            writer.Append({ i * 1.0f, i * -2.0f, 0.5f });
+        }
+        ASSERT_TRUE(writer.Finish());
+        std::string valid = stream.str();
+
+        // The first chunk follows the header: sample count, lane widths, lane bases, then its word count.
+        constexpr std::size_t kWidths = sizeof(TrajectoryHeader) + sizeof(std::uint32_t);
+        constexpr std::size_t kWordCount = sizeof(TrajectoryHeader) + 40;
+        std::vector<FVector3> decoded(16);
+        ASSERT_EQ(TrajectoryReader<FVector3>(Bytes(valid)).DecodeChunk(0, decoded), 16u);
+
+        std::string wide = valid;
+        wide[kWidths] = static_cast<char>(65);
+        EXPECT_EQ(TrajectoryReader<FVector3>(Bytes(wide)).DecodeChunk(0, decoded), 0u);
+
+        std::string truncated = valid;
+        std::memset(truncated.data() + kWordCount, 0, sizeof(std::uint64_t));
+        EXPECT_EQ(TrajectoryReader<FVector3>(Bytes(truncated)).DecodeChunk(0, decoded), 0u);
+    }
+
+    TEST(TrajectoryTest, LargeJumps)
+    {
+        std::ostringstream stream;
+        TrajectoryWriter<DVector3> writer(stream, 1.0, 4);
+        std::vector<DVector3> samples = { { 0.0, 0.0, 0.0 }, { 4e18, -4e18, 1.0 }, { -4e18, 4e18, 1.0 }, { 7.0, 0.0, 1.0 }, { 8.0, 0.0, 1.0 } };
+        for (const DVector3& sample : samples)
+        {
+            writer.Append(sample);
+        }
+        ASSERT_TRUE(writer.Finish());
+
+        std::string data = stream.str();
+        TrajectoryReader<DVector3> reader(Bytes(data));
+        ASSERT_TRUE(reader.IsValid());
+        ASSERT_EQ(reader.ChunkCount(), 2u);
+
+        std::vector<DVector3> decoded(reader.ChunkSize());
+        ASSERT_EQ(reader.DecodeChunk(0, decoded), 4u);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(decoded[i] == samples[i]);
+        }
+        ASSERT_EQ(reader.DecodeChunk(1, decoded), 1u);
+        EXPECT_TRUE(decoded[0] == samples[4]);
+        EXPECT_EQ(reader.DecodeChunk(2, decoded), 0u);
+    }
+
+    TEST(TrajectoryTest, QuaternionRoundTrip)
+    {
+        std::ostringstream stream;
+        TrajectoryWriter<FQuaternion> writer(stream, 1e-5);
+        std::vector<FQuaternion> samples;
+        for (int i = 0; i < 1000; ++i)
+        {
+            FQuaternion q = FQuaternion::FromEuler(i * 0.5f, i * 0.25f, i * -0.75f);
+            samples.push_back((i % 3 == 0) ? -q : q);
+            writer.Append(samples.back());
+        }
+        ASSERT_TRUE(writer.Finish());
+
+        std::string data = stream.str();
+        EXPECT_LT(data.size(), samples.size() * sizeof(FQuaternion) / 2);
+
+        TrajectoryReader<FQuaternion> reader(Bytes(data));
+        ASSERT_TRUE(reader.IsValid());
+        EXPECT_EQ(reader.SampleCount(), samples.size());
+
+        std::vector<FQuaternion> decoded(reader.ChunkSize());
+        std::size_t index = 0;
+        for (std::size_t chunk = 0; chunk < reader.ChunkCount(); ++chunk)
+        {
+            std::size_t count = reader.DecodeChunk(chunk, decoded);
+            for (std::size_t i = 0; i < count; ++i, ++index)
+            {
+                EXPECT_TRUE(decoded[i].IsNearlyEqual(samples[index], 1e-4f));
+            }
+        }
+        EXPECT_EQ(index, samples.size());
+    }
+
+    TEST(TrajectoryTest, Vector3RandomAccess)
+    {
+        std::ostringstream stream;
+        TrajectoryWriter<DVector3> writer(stream, 0.001, 64);
+        std::vector<DVector3> samples;
+        for (int i = 0; i < 1000; ++i)
+        {
+            samples.push_back({ std::sin(i * 0.01) * 100.0, i * 0.05, -std::cos(i * 0.02) * 3.0 });
+            writer.Append(samples.back());
+        }
+        ASSERT_TRUE(writer.Finish());
+
+        std::string data = stream.str();
+        TrajectoryReader<DVector3> reader(Bytes(data));
+        ASSERT_TRUE(reader.IsValid());
+        ASSERT_EQ(reader.ChunkCount(), 16u);
+
+        std::vector<DVector3> decoded(reader.ChunkSize());
+        ASSERT_EQ(reader.DecodeChunk(7, decoded), 64u);
+        for (std::size_t i = 0; i < 64; ++i)
+        {
+            EXPECT_TRUE(decoded[i].IsNearlyEqual(samples[7 * 64 + i], 0.001));
+        }
+        EXPECT_EQ(reader.DecodeChunk(15, decoded), 1000u - 15 * 64);
+    }
+}
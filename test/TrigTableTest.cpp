@@ -0,0 +1,83 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(TrigTableTest, FromAxisAngle)
+    {
+        FVector3 axis(1.0f, -2.0f, 0.5f);
+        auto q = FTrigTable::FromAxisAngle(axis, 63.7f);
+        EXPECT_TRUE(q.IsNearlyEqual(FQuaternion::FromAxisAngle(axis, 63.7f), 1e-6f));
+        EXPECT_TRUE(q.IsNearlyEqual(FTrigTable::FromAxisAngle(FUnitVector3(axis), 63.7f)));
+        EXPECT_EQ(FTrigTable::FromAxisAngle(FVector3(0.0f, 0.0f, 0.0f), 45.0f), FQuaternion::Identity());
+    }
+
+    TEST(TrigTableTest, FromEuler)
+    {
+        for (double roll = -180.0; roll <= 180.0; roll += 37.5)
+        {
+            for (double pitch = -90.0; pitch <= 90.0; pitch += 22.5)
+            {
+                auto expected = DQuaternion::FromEuler(roll, pitch, 71.3);
+                auto result = DTrigTable::FromEuler(roll, pitch, 71.3);
+                EXPECT_NEAR(result.w, expected.w, 1e-6);
+                EXPECT_NEAR(result.x, expected.x, 1e-6);
+                EXPECT_NEAR(result.y, expected.y, 1e-6);
+                EXPECT_NEAR(result.z, expected.z, 1e-6);
+            }
+        }
+    }
+
+    TEST(TrigTableTest, GetRotated)
+    {
+        FVector2 v(3.0f, -1.5f);
+        EXPECT_TRUE(FTrigTable::GetRotated(v, 90.0f).IsNearlyEqual({ 1.5f, 3.0f }));
+        EXPECT_TRUE(FTrigTable::GetRotated(v, -212.4f).IsNearlyEqual(v.GetRotated(-212.4f)));
+    }
+
+    TEST(TrigTableTest, QuaternionCache)
+    {
+        FQuaternionCache cache;
+        EXPECT_EQ(cache.size(), 3600u);
+        EXPECT_NEAR(cache.Step(), 0.1f, 1e-6f);
+
+        EXPECT_TRUE(cache.AboutY(90.0f).IsNearlyEqual(FQuaternion::FromAxisAngle(FVector3(0.0f, 1.0f, 0.0f), 90.0f)));
+        EXPECT_EQ(cache.AboutX(12.34f), cache.AboutX(12.3f));
+        EXPECT_EQ(cache.AboutZ(-30.0f), cache.AboutZ(330.0f));
+        EXPECT_EQ(cache.AboutZ(720.0f), FQuaternion::Identity());
+        EXPECT_EQ(cache.AboutX(std::numeric_limits<float>::quiet_NaN()), FQuaternion::Identity());
+        EXPECT_EQ(cache.AboutY(std::numeric_limits<float>::infinity()), FQuaternion::Identity());
+        EXPECT_EQ(cache.AboutZ(3.6e30f), cache.AboutZ(std::fmod(3.6e30f, 360.0f)));
+
+        auto expected = FQuaternion::FromEuler(10.5f, -45.2f, 170.0f);
+        EXPECT_TRUE(cache.FromEuler(10.5f, -45.2f, 170.0f).IsNearlyEqual(expected));
+    }
+
+    TEST(TrigTableTest, SinCos)
+    {
+        for (double degrees = -1000.0; degrees <= 1000.0; degrees += 0.37)
+        {
+            double sinT;
+            double cosT;
+            DTrigTable::SinCos(degrees, sinT, cosT);
+            double radians = degrees * kDegreesToRadians<double>;
+            EXPECT_NEAR(sinT, std::sin(radians), 3e-7);
+            EXPECT_NEAR(cosT, std::cos(radians), 3e-7);
+        }
+
+        EXPECT_EQ(FTrigTable::Sin(0.0f), 0.0f);
+        EXPECT_EQ(FTrigTable::Sin(90.0f), 1.0f);
+        EXPECT_EQ(FTrigTable::Cos(180.0f), -1.0f);
+        EXPECT_EQ(FTrigTable::Sin(-90.0f), -1.0f);
+
+        // Large angles wrap exactly; non-finite ones read a valid entry and return NaN.
+        EXPECT_NEAR(DTrigTable::Sin(360.0 * 1e12 + 30.0), 0.5, 3e-7);
+        EXPECT_TRUE(std::isnan(FTrigTable::Sin(std::numeric_limits<float>::quiet_NaN())));
+        EXPECT_TRUE(std::isnan(FTrigTable::Cos(-std::numeric_limits<float>::infinity())));
+    }
+}
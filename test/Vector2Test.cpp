@@ -1,6 +1,8 @@
 /// Copyright (c) 2026 Jose Ilitzky
 
 #include <gtest/gtest.h>
+#include <format>
+#include <string>
 
 import Vec23;
 
@@ -110,6 +112,17 @@ namespace Vec23::Test
         EXPECT_TRUE(v1.Dot(v4) == -1.0f);
     }
 
+    TEST(Vector2Test, Format)
+    {
+        FVector2 v(1.5f, -2.0f);
+        EXPECT_EQ(v.ToString(), "(1.5, -2)");
+        EXPECT_EQ(std::format("{:.2f}", v), "(1.50, -2.00)");
+
+        char buffer[32];
+        auto result = std::format_to_n(buffer, sizeof(buffer), "{}", v);
+        EXPECT_EQ(std::string(buffer, result.out), "(1.5, -2)");
+    }
+
     TEST(Vector2Test, GetNormalized)
     {
         FVector2 v(0.0f, 5.0f);
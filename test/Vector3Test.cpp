@@ -1,6 +1,8 @@
 /// Copyright (c) 2026 Jose Ilitzky
 
 #include <gtest/gtest.h>
+#include <format>
+#include <string>
 
 import Vec23;
 
@@ -116,6 +118,17 @@ namespace Vec23::Test
         EXPECT_TRUE(v1.Dot(v4) == -1.0f);
     }
 
+    TEST(Vector3Test, Format)
+    {
+        DVector3 v(1.0, 0.25, -3.5);
+        EXPECT_EQ(v.ToString(), "(1, 0.25, -3.5)");
+        EXPECT_EQ(std::format("{:.1f}", v), "(1.0, 0.2, -3.5)");
+
+        char buffer[32];
+        auto result = std::format_to_n(buffer, sizeof(buffer), "{}", v);
+        EXPECT_EQ(std::string(buffer, result.out), "(1, 0.25, -3.5)");
+    }
+
     TEST(Vector3Test, GetNormalized)
     {
         FVector3 v(0.0f, 5.0f, 0.0f);
@@ -264,6 +277,17 @@ namespace Vec23::Test
         EXPECT_TRUE(v.IsNearlyEqual({ 0.0f, 5.0f, 0.0f }));
     }
 
+    TEST(Vector3Test, RotateUnitAxis)
+    {
+        FVector3 r(1.0f, 2.0f, 0.0f);
+        r.Rotate(90.0f, FUnitVector3::UnitY());
+        EXPECT_TRUE(r.IsNearlyEqual({ 0.0f, 2.0f, -1.0f }));
+
+        FVector3 v(1.0f, 2.0f, 3.0f);
+        FVector3 axis(1.0f, 1.0f, 0.0f);
+        EXPECT_TRUE(v.GetRotated(30.0f, FUnitVector3(axis)).IsNearlyEqual(v.GetRotated(30.0f, axis)));
+    }
+
     TEST(Vector3Test, SignedAngle)
     {
         FVector3 a(1.0f, 0.0f, 0.0f);
@@ -294,6 +318,26 @@ namespace Vec23::Test
         EXPECT_TRUE(result.IsNearlyEqual({ 3.0f, 3.0f, 3.0f }));
     }
 
+    TEST(Vector3Test, UnitVector3)
+    {
+        FUnitVector3 u(FVector3(0.0f, 3.0f, 4.0f));
+        EXPECT_TRUE(u.Get().IsNormalized());
+        EXPECT_TRUE(u.Get().IsNearlyEqual({ 0.0f, 0.6f, 0.8f }));
+
+        FUnitVector3 degenerate(FVector3(0.0f, 0.0f, 0.0f));
+        EXPECT_EQ(degenerate, FUnitVector3::UnitX());
+        EXPECT_EQ(FUnitVector3(), FUnitVector3::UnitX());
+
+        EXPECT_FLOAT_EQ(FUnitVector3::UnitX().Dot(FUnitVector3::UnitY()), 0.0f);
+        EXPECT_TRUE(FUnitVector3::UnitX().Cross(FUnitVector3::UnitY()).IsNearlyEqual(FUnitVector3::UnitZ()));
+        EXPECT_TRUE((-FUnitVector3::UnitZ()).Get().IsNearlyEqual({ 0.0f, 0.0f, -1.0f }));
+        EXPECT_TRUE((FUnitVector3::UnitY() * 2.0f).IsNearlyEqual({ 0.0f, 2.0f, 0.0f }));
+
+        FUnitVector3 rotated = FUnitVector3::UnitX().GetRotated(90.0f, FUnitVector3::UnitZ());
+        EXPECT_TRUE(rotated.Get().IsNearlyEqual({ 0.0f, 1.0f, 0.0f }));
+        EXPECT_TRUE(rotated.Get().IsNormalized());
+    }
+
     // -------------------------
     // Static Tests
     // -------------------------
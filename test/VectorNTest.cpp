@@ -0,0 +1,132 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <format>
+#include <limits>
+#include <string>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(VectorNTest, Alignment)
+    {
+        EXPECT_EQ(alignof(FVector4), 16u);
+        EXPECT_EQ(sizeof(FVector4), 16u);
+        EXPECT_EQ(alignof(VectorN<double, 2>), 16u);
+        EXPECT_EQ(alignof(VectorN<float, 3>), 16u);
+        EXPECT_EQ(sizeof(VectorN<float, 3>), 16u);
+        EXPECT_EQ(sizeof(VectorN<double, 3>), sizeof(DVector3));
+    }
+
+    TEST(VectorNTest, Arithmetic)
+    {
+        FVector4 a(1.0f, 2.0f, 3.0f, 4.0f);
+        FVector4 b(4.0f, 3.0f, 2.0f, 1.0f);
+        EXPECT_EQ(a + b, FVector4::Filled(5.0f));
+        EXPECT_EQ(a - b, FVector4(-3.0f, -1.0f, 1.0f, 3.0f));
+        EXPECT_EQ(a * b, FVector4(4.0f, 6.0f, 6.0f, 4.0f));
+        EXPECT_EQ(a * 2.0f, 2.0f * a);
+        EXPECT_EQ(a / 2.0f, FVector4(0.5f, 1.0f, 1.5f, 2.0f));
+        EXPECT_EQ(-a, FVector4(-1.0f, -2.0f, -3.0f, -4.0f));
+        EXPECT_FLOAT_EQ(a.Dot(b), 20.0f);
+        EXPECT_FLOAT_EQ(a[2], 3.0f);
+
+        a += b;
+        a -= FVector4::Filled(1.0f);
+        a *= 2.0f;
+        a /= 4.0f;
+        EXPECT_EQ(a, FVector4::Filled(2.0f));
+    }
+
+    TEST(VectorNTest, DefaultConstructor)
+    {
+        VectorN<double, 5> v;
+        EXPECT_EQ(v, (VectorN<double, 5>::Filled(0.0)));
+        EXPECT_DOUBLE_EQ(v.LengthSquared(), 0.0);
+    }
+
+    TEST(VectorNTest, Format)
+    {
+        FVector4 v(1.0f, 2.5f, -3.0f, 0.0f);
+        EXPECT_EQ(std::format("{}", v), "(1, 2.5, -3, 0)");
+        EXPECT_EQ(v.ToString(), "(1, 2.5, -3, 0)");
+    }
+
+    TEST(VectorNTest, Homogeneous)
+    {
+        FVector3 p(1.0f, 2.0f, 3.0f);
+        EXPECT_EQ(FVector4::FromPoint(p), FVector4(1.0f, 2.0f, 3.0f, 1.0f));
+        EXPECT_EQ(FVector4::FromDirection(p), FVector4(1.0f, 2.0f, 3.0f, 0.0f));
+        EXPECT_EQ(FVector4(2.0f, 4.0f, 6.0f, 2.0f).ToCartesian(), p);
+        EXPECT_EQ(FVector4::FromDirection(p).ToCartesian(), p);
+        EXPECT_EQ(FVector4::FromPoint(p).ToVector3(), p);
+    }
+
+    TEST(VectorNTest, MatchesVector3)
+    {
+        using FVectorN3 = VectorN<float, 3>;
+        using FVectorN2 = VectorN<float, 2>;
+
+        FVector3 a(1.0f, -2.0f, 0.5f);
+        FVector3 n = FVector3(0.3f, 1.0f, 0.2f).GetNormalized();
+        FVectorN3 an(a);
+        FVectorN3 nn(n);
+
+        EXPECT_FLOAT_EQ(an.Dot(nn), a.Dot(n));
+        EXPECT_FLOAT_EQ(an.Length(), a.Length());
+        EXPECT_TRUE(an.GetNormalized().ToVector3().IsNearlyEqual(a.GetNormalized()));
+        EXPECT_TRUE(FVectorN3::Reflect(an, nn).ToVector3().IsNearlyEqual(FVector3::Reflect(a, n)));
+        EXPECT_TRUE(FVectorN3::Lerp(an, nn, 0.25f).ToVector3().IsNearlyEqual(FVector3::Lerp(a, n, 0.25f)));
+        EXPECT_FLOAT_EQ(FVectorN3::Distance(an, nn), FVector3::Distance(a, n));
+        EXPECT_EQ(FVectorN3::Filled(2.0f), FVectorN3(2.0f, 2.0f, 2.0f));
+
+        FVector2 v(3.0f, 4.0f);
+        EXPECT_EQ(FVectorN2(v).ToVector2(), v);
+    }
+
+    TEST(VectorNTest, MinMax)
+    {
+        FVector4 a(1.0f, 5.0f, -2.0f, 0.0f);
+        FVector4 b(2.0f, 4.0f, -3.0f, 0.0f);
+        EXPECT_EQ(FVector4::Min(a, b), FVector4(1.0f, 4.0f, -3.0f, 0.0f));
+        EXPECT_EQ(FVector4::Max(a, b), FVector4(2.0f, 5.0f, -2.0f, 0.0f));
+    }
+
+    TEST(VectorNTest, Normalize)
+    {
+        DVector4 v(1.0, 1.0, 1.0, 1.0);
+        v.Normalize();
+        EXPECT_TRUE(v.IsNormalized());
+        EXPECT_TRUE(v.IsNearlyEqual(DVector4::Filled(0.5)));
+
+        DVector4 zero;
+        zero.Normalize();
+        EXPECT_EQ(zero, DVector4());
+    }
+
+    TEST(VectorNTest, PaddingStaysZero)
+    {
+        constexpr float kInfinity = std::numeric_limits<float>::infinity();
+        VectorN<float, 3> v = VectorN<float, 3>(1.0f, 0.0f, 0.0f) * kInfinity;
+        v[0] = 1.0f;
+        v[1] = 2.0f;
+        v[2] = 2.0f;
+        EXPECT_FLOAT_EQ(v.LengthSquared(), 9.0f);
+        EXPECT_EQ(v, (VectorN<float, 3>(1.0f, 2.0f, 2.0f)));
+
+        v = VectorN<float, 3>::Lerp(VectorN<float, 3>(), VectorN<float, 3>(1.0f, 1.0f, 1.0f), kInfinity);
+        v[0] = v[1] = v[2] = 0.0f;
+        EXPECT_EQ(v, (VectorN<float, 3>()));
+    }
+
+    // -------------------------
+    // Static Tests
+    // -------------------------
+
+    constexpr FVector4 kUnitW(0.0f, 0.0f, 0.0f, 1.0f);
+    static_assert(kUnitW.Dot(kUnitW) == 1.0f);
+    static_assert(kUnitW + kUnitW == FVector4(0.0f, 0.0f, 0.0f, 2.0f));
+    static_assert(-kUnitW == FVector4(0.0f, 0.0f, 0.0f, -1.0f));
+    static_assert(kUnitW[3] == 1.0f);
+}
@@ -0,0 +1,112 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(VertexWeldTest, ChainedPointsMergeIntoFirst)
+    {
+        std::vector<FVector3> points =
+        {
+            { 0.0f, 0.0f, 0.0f },
+            { 0.6f, 0.0f, 0.0f },
+            { 1.2f, 0.0f, 0.0f },
+        };
+
+        FVertexWeld weld = FVertexWeld::FromPoints(points, 1.0f);
+        ASSERT_EQ(weld.vertices.size(), 2u);
+        EXPECT_EQ(weld.remap[0], 0u);
+        EXPECT_EQ(weld.remap[1], 0u);
+        EXPECT_EQ(weld.remap[2], 1u);
+        EXPECT_TRUE(weld.vertices[1] == points[2]);
+    }
+
+    TEST(VertexWeldTest, Empty)
+    {
+        std::vector<FVector3> points;
+        FVertexWeld weld = FVertexWeld::FromPoints(points);
+        EXPECT_TRUE(weld.vertices.empty());
+        EXPECT_TRUE(weld.remap.empty());
+    }
+
+    TEST(VertexWeldTest, LargeGrid)
+    {
+        std::vector<FVector3> points;
+        for (int copy = 0; copy < 2; ++copy)
+        {
+            for (int i = 0; i < 40; ++i)
+            {
+                for (int j = 0; j < 40; ++j)
+                {
+                    for (int k = 0; k < 40; ++k)
+                    {
+                        float jitter = copy * 0.00001f;
+                        points.push_back({ i + jitter, j - jitter, k + jitter });
+                    }
+                }
+            }
+        }
+
+        FVertexWeld weld = FVertexWeld::FromPoints(points);
+        ASSERT_EQ(weld.vertices.size(), points.size() / 2);
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            EXPECT_EQ(weld.remap[i], i % weld.vertices.size());
+            EXPECT_TRUE(points[i].IsNearlyEqual(weld.vertices[weld.remap[i]]));
+        }
+    }
+
+    TEST(VertexWeldTest, MatchesIsNearlyEqual)
+    {
+        std::vector<FVector3> points =
+        {
+            { 1.0f, 0.0f, 0.0f },
+            { 1.00001f, 0.0f, 0.0f },
+            { 1.0001f, 0.0f, 0.0f },
+            { -1.0f, 0.0f, 0.0f },
+        };
+
+        FVertexWeld weld = FVertexWeld::FromPoints(points);
+        ASSERT_EQ(weld.vertices.size(), 3u);
+        EXPECT_EQ(weld.remap[0], 0u);
+        EXPECT_EQ(weld.remap[1], 0u);
+        EXPECT_EQ(weld.remap[2], 1u);
+        EXPECT_EQ(weld.remap[3], 2u);
+    }
+
+    TEST(VertexWeldTest, NonFinitePoints)
+    {
+        double nan = std::numeric_limits<double>::quiet_NaN();
+        double inf = std::numeric_limits<double>::infinity();
+        std::vector<DVector3> points =
+        {
+            { 1.0, 2.0, 3.0 },
+            { nan, 0.0, 0.0 },
+            { 1.0, 2.0, 3.0 },
+            { nan, 0.0, 0.0 },
+            { inf, -inf, 0.0 },
+            { 1e300, -1e300, 0.0 },
+            { 1e300, -1e300, 0.0 },
+        };
+
+        DVertexWeld weld = DVertexWeld::FromPoints(points, 1e-12);
+        ASSERT_EQ(weld.vertices.size(), 5u);
+        EXPECT_EQ(weld.remap[2], 0u);
+        EXPECT_EQ(weld.remap[1], 1u);
+        EXPECT_EQ(weld.remap[3], 2u);
+        EXPECT_EQ(weld.remap[4], 3u);
+        EXPECT_EQ(weld.remap[6], 4u);
+    }
+
+    TEST(VertexWeldTest, NonPositiveEpsilon)
+    {
+        std::vector<DVector3> points = { { 1.0, 2.0, 3.0 }, { 1.0, 2.0, 3.0 } };
+        DVertexWeld weld = DVertexWeld::FromPoints(points, 0.0);
+        ASSERT_EQ(weld.vertices.size(), 2u);
+        EXPECT_EQ(weld.remap[1], 1u);
+    }
+}
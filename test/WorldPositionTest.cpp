@@ -0,0 +1,74 @@
+/// Copyright (c) 2026 Jose Ilitzky
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+import Vec23;
+
+namespace Vec23::Test
+{
+    TEST(WorldPositionTest, FromDouble)
+    {
+        DVector3 far(350000.123456, -120000.5, 8848.25);
+        WorldPosition position = WorldPosition::FromDouble(far);
+        EXPECT_EQ(position.anchor, DVector3(350208.0, -119808.0, 9216.0));
+        EXPECT_LE(position.offset.x, 512.0f);
+        EXPECT_TRUE(position.ToDouble().IsNearlyEqual(far, 1e-4));
+
+        // A plain float loses millimeters at this distance; the anchored form keeps them.
+        EXPECT_GT(std::abs(static_cast<double>(static_cast<float>(far.x)) - far.x), 1e-3);
+    }
+
+    TEST(WorldPositionTest, Rebase)
+    {
+        WorldPosition position = WorldPosition::FromDouble({ 5000.25, 10.5, -7000.75 });
+        position.Rebase({ 4000.0, 0.0, -8000.0 });
+        EXPECT_EQ(position.anchor, DVector3(4000.0, 0.0, -8000.0));
+        EXPECT_EQ(position.offset, FVector3(1000.25f, 10.5f, 999.25f));
+
+        position += FVector3(2000.0f, 0.0f, 0.0f);
+        position.Recenter();
+        EXPECT_EQ(position.anchor, DVector3(7168.0, 0.0, -7168.0));
+        EXPECT_TRUE(position.ToDouble().IsNearlyEqual({ 7000.25, 10.5, -7000.75 }));
+    }
+
+    TEST(WorldPositionTest, RebaseBatch)
+    {
+        std::vector<WorldPosition> positions;
+        for (int i = 0; i < 30000; ++i)
+        {
+            positions.push_back(WorldPosition::FromDouble({ 200000.0 + i * 0.125, -i * 0.5, 100.0 }));
+        }
+
+        DVector3 origin(200000.0, 0.0, 0.0);
+        WorldPosition::Rebase(positions, origin);
+        std::vector<FVector3> relative(positions.size());
+        WorldPosition::ToRelative(positions, { 200100.0, 0.0, 0.0 }, relative);
+        for (int i = 0; i < 30000; ++i)
+        {
+            EXPECT_EQ(positions[i].anchor, origin + DVector3(std::round(i * 0.125 / 1024.0), std::round(-i * 0.5 / 1024.0), 0.0) * 1024.0);
+            EXPECT_EQ(relative[i], FVector3(i * 0.125f - 100.0f, -i * 0.5f, 100.0f));
+        }
+
+        // An entity 300 km from the new origin keeps its cell anchor and a sub-millimeter offset.
+        DVector3 far(500000.0001, 0.0, 0.0);
+        std::vector<WorldPosition> distant = { WorldPosition::FromDouble(far) };
+        WorldPosition::Rebase(distant, origin);
+        EXPECT_LE(std::abs(distant[0].offset.x), 512.0f);
+        EXPECT_NEAR(distant[0].ToDouble().x, far.x, 1e-5);
+
+        std::vector<FVector3> offsets = { { 1.0f, 2.0f, 3.0f }, { -1.0f, 0.0f, 0.5f } };
+        WorldPosition::Rebase(offsets, { 1e6, 0.0, 0.0 }, { 1e6 + 10.0, 0.0, -1.0 });
+        EXPECT_EQ(offsets[0], FVector3(-9.0f, 2.0f, 4.0f));
+        EXPECT_EQ(offsets[1], FVector3(-11.0f, 0.0f, 1.5f));
+    }
+
+    TEST(WorldPositionTest, Subtract)
+    {
+        WorldPosition a({ 1e8, 0.0, 0.0 }, { 0.25f, 0.0f, 0.0f });
+        WorldPosition b({ 1e8 - 1024.0, 0.0, 0.0 }, { 1.0f, 2.0f, 0.0f });
+        EXPECT_EQ(a - b, DVector3(1023.25, -2.0, 0.0));
+        EXPECT_EQ(a + FVector3(1.0f, 0.0f, 0.0f), WorldPosition({ 1e8, 0.0, 0.0 }, { 1.25f, 0.0f, 0.0f }));
+    }
+}